@@ -23,6 +23,7 @@ public class AccessVariableByName : ModuleRules
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[]{
+			"AssetRegistry",
 			"BlueprintGraph",
 			"EditorStyle",
 			"GraphEditor",
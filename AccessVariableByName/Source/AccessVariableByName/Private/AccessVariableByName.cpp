@@ -9,10 +9,14 @@
 
 #include "AccessVariableByNameModule.h"
 #include "EdGraphUtilities.h"
+#include "Editor.h"
 #include "K2Node_DynamicGetVariableByName.h"
 #include "K2Node_DynamicSetVariableByName.h"
+#include "Kismet2/StructureEditorUtils.h"
+#include "Misc/CoreDelegates.h"
 #include "SGraphNodeDynamicGetVariableByNameNode.h"
 #include "SGraphNodeDynamicSetVariableByNameNode.h"
+#include "VariableAccessFunctionLibraryUtils.h"
 
 #define LOCTEXT_NAMESPACE "FAccessVariableByNameModule"
 
@@ -34,10 +38,28 @@ class FGraphPanelNodeFactory_AccessVariableByName : public FGraphPanelNodeFactor
 	}
 };
 
+// Members of the recompiled user defined struct are regenerated, so the cached ones must not be used anymore.
+class FStructChangedListener_AccessVariableByName : public FStructureEditorUtils::INotifyOnStructChanged
+{
+	virtual void PreChange(
+		const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override
+	{
+	}
+
+	virtual void PostChange(
+		const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override
+	{
+		FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+	}
+};
+
 void FAccessVariableByNameModule::StartupModule()
 {
 	GraphPanelNodeFactory_AccessVariableByName = MakeShareable(new FGraphPanelNodeFactory_AccessVariableByName());
 	FEdGraphUtilities::RegisterVisualNodeFactory(GraphPanelNodeFactory_AccessVariableByName);
+
+	PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FAccessVariableByNameModule::OnPostEngineInit);
+	StructChangedListener = MakeShared<FStructChangedListener_AccessVariableByName>();
 }
 
 void FAccessVariableByNameModule::ShutdownModule()
@@ -47,6 +69,23 @@ void FAccessVariableByNameModule::ShutdownModule()
 		FEdGraphUtilities::UnregisterVisualNodeFactory(GraphPanelNodeFactory_AccessVariableByName);
 		GraphPanelNodeFactory_AccessVariableByName.Reset();
 	}
+
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	StructChangedListener.Reset();
+	if (GEditor != nullptr)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+}
+
+void FAccessVariableByNameModule::OnPostEngineInit()
+{
+	// Recompiled Blueprints regenerate their properties, so the cached ones must not be used anymore.
+	if (GEditor != nullptr)
+	{
+		BlueprintCompiledHandle =
+			GEditor->OnBlueprintCompiled().AddStatic(&FVariableAccessFunctionLibraryUtils::InvalidateCaches);
+	}
 }
 
 bool FAccessVariableByNameModule::SupportsDynamicReloading()
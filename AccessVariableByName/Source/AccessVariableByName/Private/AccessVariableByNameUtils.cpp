@@ -11,6 +11,7 @@
 
 #include "EdGraphSchema_K2.h"
 #include "Internationalization/Regex.h"
+#include "UObject/PropertyPortFlags.h"
 #include "UObject/UnrealType.h"
 
 const FName ExecThenPinName(TEXT("ExecThen"));
@@ -19,12 +20,28 @@ const FName ExtendIfNotPresentPinName(TEXT("ExtendIfNotPresent"));
 const FName SuccessPinName(TEXT("Success"));
 const FName ResultPinNamePrefix(TEXT("Result_"));
 const FName NewValuePinNamePrefix(TEXT("NewValue_"));
+const FName LoopBodyPinName(TEXT("LoopBody"));
+const FName ElementPinName(TEXT("Element"));
+const FName ArrayIndexPinName(TEXT("ArrayIndex"));
+const FName KeyPinName(TEXT("Key"));
+const FName ValuePinName(TEXT("Value"));
+const FName CompletedPinName(TEXT("Completed"));
+const FName IntArgumentsPinName(TEXT("IntArguments"));
+const FName NameArgumentsPinName(TEXT("NameArguments"));
 
 const FString ExecThenPinFriendlyName(TEXT(" "));
 const FString TargetPinFriendlyName(TEXT("Target"));
 const FString VarNamePinFriendlyName(TEXT("Var Name"));
 const FString ExtendIfNotPresentPinFriendlyName(TEXT("Extend If not Present"));
 const FString SuccessPinFriendlyName(TEXT("Success"));
+const FString LoopBodyPinFriendlyName(TEXT("Loop Body"));
+const FString ElementPinFriendlyName(TEXT("Element"));
+const FString ArrayIndexPinFriendlyName(TEXT("Array Index"));
+const FString KeyPinFriendlyName(TEXT("Key"));
+const FString ValuePinFriendlyName(TEXT("Value"));
+const FString CompletedPinFriendlyName(TEXT("Completed"));
+const FString IntArgumentsPinFriendlyName(TEXT("Int Arguments"));
+const FString NameArgumentsPinFriendlyName(TEXT("Name Arguments"));
 
 TerminalProperty GetTerminalProperty(
 	const TArray<FVarDescription>& VarDescs, int32 VarDepth, UScriptStruct* OuterClass, const FAccessVariableParams& Params);
@@ -52,11 +69,19 @@ UClass* GetClassFromNode(const UEdGraphNode* Node)
 	return Class;
 }
 
-TTuple<FProperty*, UClass*> GetObjectProperty(UClass* TargetClass, FString VarName, bool bFindGeneratedBy)
+FString MakeAccessVariableParamsLiteral(const FAccessVariableParams& Params)
+{
+	FString Literal;
+	FAccessVariableParams::StaticStruct()->ExportText(Literal, &Params, nullptr, nullptr, PPF_None, nullptr);
+
+	return Literal;
+}
+
+TTuple<FProperty*, UClass*> GetObjectProperty(UClass* TargetClass, FName VarName, bool bFindGeneratedBy)
 {
 	const TTuple<FProperty*, UClass*> NullReturn(nullptr, nullptr);
 
-	FProperty* Property = FindFProperty<FProperty>(TargetClass, *VarName);
+	FProperty* Property = FVariableAccessFunctionLibraryUtils::FindClassProperty(TargetClass, VarName);
 	if (Property != nullptr)
 	{
 		return TTuple<FProperty*, UClass*>(Property, TargetClass);
@@ -70,7 +95,7 @@ TTuple<FProperty*, UClass*> GetObjectProperty(UClass* TargetClass, FString VarNa
 			return NullReturn;
 		}
 
-		Property = FindFProperty<FProperty>(Blueprint->GetClass(), *VarName);
+		Property = FVariableAccessFunctionLibraryUtils::FindClassProperty(Blueprint->GetClass(), VarName);
 		if (Property == nullptr)
 		{
 			return NullReturn;
@@ -258,7 +283,7 @@ TerminalProperty GetTerminalProperty(
 		return TerminalProperty();
 	}
 
-	TTuple<FProperty*, UClass*> Result = GetObjectProperty(OuterClass, Desc.VarName, Params.bIncludeGenerationClass);
+	TTuple<FProperty*, UClass*> Result = GetObjectProperty(OuterClass, Desc.Name, Params.bIncludeGenerationClass);
 	if (Result.Get<0>() == nullptr || Result.Get<1>() == nullptr)
 	{
 		return TerminalProperty();
@@ -266,3 +291,47 @@ TerminalProperty GetTerminalProperty(
 
 	return GetTerminalPropertyInternal(VarDescs, VarDepth, Result.Get<0>(), Params);
 }
+
+bool IsPathWithinTarget(const TArray<FVarDescription>& VarDescs, UClass* TargetClass)
+{
+	if (TargetClass == nullptr || VarDescs.Num() == 0)
+	{
+		return false;
+	}
+
+	UScriptStruct* OuterStruct = nullptr;
+	for (int32 VarDepth = 0; VarDepth < VarDescs.Num(); ++VarDepth)
+	{
+		const FVarDescription& Desc = VarDescs[VarDepth];
+		if (!Desc.bIsValid || Desc.ArrayAccessType != EArrayAccessType::ArrayAccessType_None)
+		{
+			return false;
+		}
+
+		FProperty* Property = nullptr;
+		if (OuterStruct == nullptr)
+		{
+			Property = FVariableAccessFunctionLibraryUtils::FindClassProperty(TargetClass, Desc.Name);
+		}
+		else
+		{
+			Property = FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(OuterStruct, Desc.VarName);
+		}
+		if (Property == nullptr)
+		{
+			return false;
+		}
+
+		if (VarDepth + 1 < VarDescs.Num())
+		{
+			FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			if (StructProperty == nullptr)
+			{
+				return false;
+			}
+			OuterStruct = StructProperty->Struct;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,388 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "GenerateNativeAccessorsCommandlet.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_GetVariableByName.h"
+#include "K2Node_SetVariableByName.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UnrealType.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+#include "AssetRegistryModule.h"
+#else
+#include "AssetRegistry/AssetRegistryModule.h"
+#endif
+
+namespace FGenerateNativeAccessors
+{
+// Variable path accessed by name on the class.
+struct FRequest
+{
+	UClass* Class = nullptr;
+	FString VarName;
+	// Where the path is found, which is reported if the accessor can not be generated.
+	FString Source;
+};
+
+// Member access of the path, which is generated on the native class declaring the first member.
+struct FAccessor
+{
+	UClass* OwnerClass = nullptr;
+	FString VarName;
+	FString IncludePath;
+};
+
+void AddNodeRequest(UBlueprint* Blueprint, UEdGraphPin* TargetPin, UEdGraphPin* VarNamePin, TArray<FRequest>* OutRequests)
+{
+	// Only the literal paths are known before the game runs.
+	if (TargetPin == nullptr || VarNamePin == nullptr || VarNamePin->LinkedTo.Num() != 0 || VarNamePin->DefaultValue.IsEmpty())
+	{
+		return;
+	}
+
+	UClass* TargetClass = Blueprint->GeneratedClass;
+	if (TargetPin->LinkedTo.Num() > 0 && TargetPin->LinkedTo[0]->PinType.PinSubCategory != UEdGraphSchema_K2::PN_Self)
+	{
+		TargetClass = Cast<UClass>(TargetPin->LinkedTo[0]->PinType.PinSubCategoryObject.Get());
+	}
+	if (TargetClass == nullptr)
+	{
+		return;
+	}
+
+	FRequest& Request = OutRequests->AddDefaulted_GetRef();
+	Request.Class = TargetClass;
+	Request.VarName = VarNamePin->DefaultValue;
+	Request.Source = Blueprint->GetPathName();
+}
+
+void CollectBlueprintRequests(TArray<FRequest>* OutRequests)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+	Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+#else
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+#endif
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(TEXT("/Game"));
+	Filter.bRecursivePaths = true;
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	for (const FAssetData& Asset : Assets)
+	{
+		UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset());
+		if (Blueprint == nullptr)
+		{
+			continue;
+		}
+
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+		for (UEdGraph* Graph : Graphs)
+		{
+			TArray<UK2Node_GetVariableByNameNode*> GetNodes;
+			Graph->GetNodesOfClass(GetNodes);
+			for (UK2Node_GetVariableByNameNode* Node : GetNodes)
+			{
+				AddNodeRequest(Blueprint, Node->GetTargetPin(), Node->GetVarNamePin(), OutRequests);
+			}
+
+			TArray<UK2Node_SetVariableByNameNode*> SetNodes;
+			Graph->GetNodesOfClass(SetNodes);
+			for (UK2Node_SetVariableByNameNode* Node : SetNodes)
+			{
+				AddNodeRequest(Blueprint, Node->GetTargetPin(), Node->GetVarNamePin(), OutRequests);
+			}
+		}
+	}
+}
+
+// Entry is "ClassPath:VarName" (e.g. "/Script/Engine.Actor:PrimaryActorTick.TickInterval").
+void AddListedRequest(const FString& Entry, const FString& Source, TArray<FRequest>* OutRequests)
+{
+	FString ClassPath;
+	FString VarName;
+	if (!Entry.TrimStartAndEnd().Split(TEXT(":"), &ClassPath, &VarName))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("'%s' in %s is not 'ClassPath:VarName'."), *Entry, *Source);
+		return;
+	}
+
+	UClass* Class = LoadObject<UClass>(nullptr, *ClassPath);
+	if (Class == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Class '%s' in %s is not found."), *ClassPath, *Source);
+		return;
+	}
+
+	FRequest& Request = OutRequests->AddDefaulted_GetRef();
+	Request.Class = Class;
+	Request.VarName = VarName;
+	Request.Source = Source;
+}
+
+// Return false with the reason if the path can not be accessed as a C++ member from outside of the class.
+bool MakeAccessor(const FRequest& Request, FAccessor* OutAccessor, FString* OutReason)
+{
+	TArray<FVarDescription> VarDescs;
+	if (!FVariableAccessFunctionLibraryUtils::ParseVarName(Request.VarName, &VarDescs) || VarDescs.Num() == 0)
+	{
+		*OutReason = TEXT("the path is malformed");
+		return false;
+	}
+
+	TArray<FString> Members;
+	UScriptStruct* OuterStruct = nullptr;
+	for (int32 VarDepth = 0; VarDepth < VarDescs.Num(); ++VarDepth)
+	{
+		const FVarDescription& Desc = VarDescs[VarDepth];
+		if (!Desc.bIsValid || Desc.ArrayAccessType != EArrayAccessType::ArrayAccessType_None)
+		{
+			*OutReason = TEXT("the elements of the containers are accessed by the reflection");
+			return false;
+		}
+
+		FProperty* Property = nullptr;
+		if (OuterStruct == nullptr)
+		{
+			Property = FVariableAccessFunctionLibraryUtils::FindClassProperty(Request.Class, Desc.Name);
+		}
+		else
+		{
+			Property = FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(OuterStruct, Desc.VarName);
+		}
+		if (Property == nullptr)
+		{
+			*OutReason = FString::Printf(TEXT("'%s' is not found"), *Desc.VarName);
+			return false;
+		}
+
+		if (OuterStruct == nullptr)
+		{
+			OutAccessor->OwnerClass = Property->GetOwnerClass();
+			if (OutAccessor->OwnerClass == nullptr || !OutAccessor->OwnerClass->HasAnyClassFlags(CLASS_Native))
+			{
+				*OutReason = FString::Printf(TEXT("'%s' is declared in a Blueprint"), *Desc.VarName);
+				return false;
+			}
+		}
+		else if ((OuterStruct->StructFlags & STRUCT_Native) == 0)
+		{
+			*OutReason = FString::Printf(TEXT("'%s' is a member of a user defined struct"), *Desc.VarName);
+			return false;
+		}
+
+		if (!Property->HasAnyPropertyFlags(CPF_NativeAccessSpecifierPublic))
+		{
+			*OutReason = FString::Printf(TEXT("'%s' is not public"), *Desc.VarName);
+			return false;
+		}
+		if (Property->HasAnyPropertyFlags(CPF_EditorOnly) || Property->ArrayDim != 1)
+		{
+			*OutReason = FString::Printf(TEXT("'%s' is editor only data or a static array"), *Desc.VarName);
+			return false;
+		}
+		FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+		if (BoolProperty != nullptr && !BoolProperty->IsNativeBool())
+		{
+			*OutReason = FString::Printf(TEXT("'%s' is a bitfield"), *Desc.VarName);
+			return false;
+		}
+		Members.Add(Property->GetName());
+
+		if (VarDepth + 1 < VarDescs.Num())
+		{
+			FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			if (StructProperty == nullptr)
+			{
+				*OutReason = FString::Printf(TEXT("'%s' is not a struct, and only the struct members are followed"), *Desc.VarName);
+				return false;
+			}
+			OuterStruct = StructProperty->Struct;
+		}
+	}
+
+	OutAccessor->IncludePath = OutAccessor->OwnerClass->GetMetaData(TEXT("IncludePath"));
+	if (OutAccessor->IncludePath.IsEmpty())
+	{
+		*OutReason = FString::Printf(TEXT("the header of %s is unknown"), *OutAccessor->OwnerClass->GetName());
+		return false;
+	}
+	OutAccessor->VarName = FString::Join(Members, TEXT("."));
+
+	return true;
+}
+
+FString GetCppClassName(const UClass* Class)
+{
+	return FString::Printf(TEXT("%s%s"), Class->GetPrefixCPP(), *Class->GetName());
+}
+
+FString GenerateSource(const TArray<FAccessor>& Accessors, const FString& OutputPath)
+{
+	// The generated files of a module are compiled together in the unity build.
+	FString Namespace = TEXT("VarAccessNativeAccessors_") + FPaths::GetBaseFilename(OutputPath);
+	for (TCHAR& Ch : Namespace)
+	{
+		if (!FChar::IsAlnum(Ch))
+		{
+			Ch = TEXT('_');
+		}
+	}
+
+	TArray<FString> IncludePaths;
+	for (const FAccessor& Accessor : Accessors)
+	{
+		IncludePaths.AddUnique(Accessor.IncludePath);
+	}
+	IncludePaths.Sort();
+
+	FString Source;
+	Source += TEXT("// Generated by the GenerateNativeAccessors commandlet of AccessVariableByName. Do not edit.\n");
+	Source += TEXT("// The module compiling this file depends on VariableAccessFunctionLibrary and the modules of the classes.\n");
+	Source += TEXT("\n#include \"VariableAccessNativeAccessors.h\"\n");
+	for (const FString& IncludePath : IncludePaths)
+	{
+		Source += FString::Printf(TEXT("#include \"%s\"\n"), *IncludePath);
+	}
+
+	Source += FString::Printf(TEXT("\nnamespace %s\n{\n"), *Namespace);
+	for (int32 Index = 0; Index < Accessors.Num(); ++Index)
+	{
+		// Typed functions which access the member directly. The type is the declared type of the member.
+		const FString ClassName = GetCppClassName(Accessors[Index].OwnerClass);
+		const FString& Member = Accessors[Index].VarName;
+		Source += FString::Printf(TEXT("using FType%d = decltype(DeclVal<%s&>().%s);\n\n"), Index, *ClassName, *Member);
+		Source += FString::Printf(TEXT("const FType%d& Get%d(const UObject* Target)\n{\n"), Index, Index);
+		Source += FString::Printf(TEXT("\treturn static_cast<const %s*>(Target)->%s;\n}\n\n"), *ClassName, *Member);
+		Source += FString::Printf(TEXT("void Set%d(UObject* Target, const FType%d& Value)\n{\n"), Index, Index);
+		Source += FString::Printf(TEXT("\tstatic_cast<%s*>(Target)->%s = Value;\n}\n\n"), *ClassName, *Member);
+	}
+
+	Source += TEXT("const FVarAccessNativeAccessor Accessors[] = {\n");
+	for (int32 Index = 0; Index < Accessors.Num(); ++Index)
+	{
+		Source += FString::Printf(TEXT("\tMakeVarAccessNativeAccessor<FType%d, &Get%d, &Set%d>(&%s::StaticClass, TEXT(\"%s\")),\n"),
+			Index, Index, Index, *GetCppClassName(Accessors[Index].OwnerClass), *Accessors[Index].VarName);
+	}
+	Source += TEXT("};\n\nFVarAccessNativeAccessorRegistration Registration(Accessors);\n");
+	Source += FString::Printf(TEXT("}\t // namespace %s\n"), *Namespace);
+
+	return Source;
+}
+}	 // namespace FGenerateNativeAccessors
+
+UGenerateNativeAccessorsCommandlet::UGenerateNativeAccessorsCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGenerateNativeAccessorsCommandlet::Main(const FString& Params)
+{
+	using namespace FGenerateNativeAccessors;
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("-Output=<File> is required."));
+		return 1;
+	}
+	if (FPaths::IsRelative(OutputPath))
+	{
+		OutputPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), OutputPath);
+	}
+
+	TArray<FRequest> Requests;
+	if (FParse::Param(*Params, TEXT("Blueprints")))
+	{
+		CollectBlueprintRequests(&Requests);
+	}
+	FString Paths;
+	if (FParse::Value(*Params, TEXT("Paths="), Paths, false))
+	{
+		TArray<FString> Entries;
+		Paths.ParseIntoArray(Entries, TEXT(","));
+		for (const FString& Entry : Entries)
+		{
+			AddListedRequest(Entry, TEXT("-Paths"), &Requests);
+		}
+	}
+	FString PathsFile;
+	if (FParse::Value(*Params, TEXT("PathsFile="), PathsFile))
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *PathsFile))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to read %s."), *PathsFile);
+			return 1;
+		}
+		for (const FString& Line : Lines)
+		{
+			if (!Line.TrimStart().IsEmpty() && !Line.TrimStart().StartsWith(TEXT("#")))
+			{
+				AddListedRequest(Line, PathsFile, &Requests);
+			}
+		}
+	}
+
+	TArray<FAccessor> Accessors;
+	for (const FRequest& Request : Requests)
+	{
+		FAccessor Accessor;
+		FString Reason;
+		if (!MakeAccessor(Request, &Accessor, &Reason))
+		{
+			UE_LOG(LogTemp, Display, TEXT("Skip '%s' on %s in %s: %s."), *Request.VarName, *Request.Class->GetName(),
+				*Request.Source, *Reason);
+			continue;
+		}
+
+		const bool bDuplicated = Accessors.ContainsByPredicate([&Accessor](const FAccessor& Other)
+			{ return Other.OwnerClass == Accessor.OwnerClass && Other.VarName == Accessor.VarName; });
+		if (!bDuplicated)
+		{
+			Accessors.Add(Accessor);
+		}
+	}
+	// The output is stable, so that it is regenerated without a diff.
+	Accessors.Sort(
+		[](const FAccessor& A, const FAccessor& B)
+		{
+			const FString NameA = A.OwnerClass->GetPathName();
+			const FString NameB = B.OwnerClass->GetPathName();
+			return NameA != NameB ? NameA < NameB : A.VarName < B.VarName;
+		});
+
+	if (!FFileHelper::SaveStringToFile(
+			GenerateSource(Accessors, OutputPath), *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write %s."), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("Generated %d native accessors of %d requested paths to %s."), Accessors.Num(), Requests.Num(),
+		*OutputPath);
+
+	return 0;
+}
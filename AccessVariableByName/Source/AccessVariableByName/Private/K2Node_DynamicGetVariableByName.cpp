@@ -85,6 +85,13 @@ public:
 					{
 						RegisterLiteral(Context, Pin);
 					}
+					else if (Pin == Node->GetIntArgumentsPin() || Pin == Node->GetNameArgumentsPin())
+					{
+						// Unlinked arguments are passed as empty arrays.
+						FString NewName = FString::Format(TEXT("{0}_{1}"), {*Node->GetName(), *Pin->PinName.ToString()});
+						FBPTerminal* Term = Context.CreateLocalTerminalFromPinAutoChooseScope(Pin, NewName);
+						Context.NetMap.Add(Pin, Term);
+					}
 				}
 			}
 
@@ -100,29 +107,19 @@ public:
 		}
 	}
 
-	void RegisterTemporaryNets(FKismetFunctionContext& Context, UK2Node_DynamicGetVariableByNameNode* Node)
+	void RegisterParameterNets(FKismetFunctionContext& Context, UK2Node_DynamicGetVariableByNameNode* Node)
 	{
-		FBPTerminal* AccessVariableParams = Context.CreateLocalTerminal();
+		// Parameters are known at compile time, so pass them as a struct literal instead of building them on every access.
+		FBPTerminal* AccessVariableParams = Context.CreateLocalTerminal(ETerminalSpecification::TS_Literal);
+		AccessVariableParams->bIsLiteral = true;
 		AccessVariableParams->Type.PinCategory = UEdGraphSchema_K2::PC_Struct;
 		AccessVariableParams->Type.PinSubCategoryObject = FAccessVariableParams::StaticStruct();
-		AccessVariableParams->Name = Context.NetNameMap->MakeValidName(Node, TEXT("AccessVariableParamsTemp"));
+		FAccessVariableParams Params;
+		Params.bIncludeGenerationClass = Node->bIncludeGenerationClass;
+		Params.bCacheObjectChain = Node->bCacheObjectChain;
+		AccessVariableParams->Name = MakeAccessVariableParamsLiteral(Params);
 		AccessVariableParams->Source = Node;
-		TermMap.Add("AccessVariableParamsTemp", AccessVariableParams);
-	}
-
-	void RegisterParameterNets(FKismetFunctionContext& Context, UK2Node_DynamicGetVariableByNameNode* Node)
-	{
-		FBPTerminal* IncludeGenerationClass = Context.CreateLocalTerminal(ETerminalSpecification::TS_Literal);
-		IncludeGenerationClass->bIsLiteral = true;
-		IncludeGenerationClass->Type.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-		IncludeGenerationClass->Name = Node->bIncludeGenerationClass ? TEXT("true") : TEXT("false");
-		TermMap.Add("bIncludeGenerationClass", IncludeGenerationClass);
-
-		FBPTerminal* ExtendIfNotPresent = Context.CreateLocalTerminal(ETerminalSpecification::TS_Literal);
-		ExtendIfNotPresent->bIsLiteral = true;
-		ExtendIfNotPresent->Type.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-		ExtendIfNotPresent->Name = TEXT("false");
-		TermMap.Add("bExtendIfNotPresent", ExtendIfNotPresent);
+		TermMap.Add("AccessVariableParams", AccessVariableParams);
 	}
 
 	virtual void RegisterNets(FKismetFunctionContext& Context, UEdGraphNode* Node) override
@@ -133,25 +130,9 @@ public:
 		FNodeHandlingFunctor::RegisterNets(Context, Node);
 
 		RegisterNodePinNets(Context, DynamicGetVariableByNameNode);
-		RegisterTemporaryNets(Context, DynamicGetVariableByNameNode);
 		RegisterParameterNets(Context, DynamicGetVariableByNameNode);
 	}
 
-	void CreateMakeStructStatement(FKismetFunctionContext& Context, UK2Node_DynamicGetVariableByNameNode* Node)
-	{
-		UClass* FunctionClass = UVariableAccessUtilLibrary::StaticClass();
-		UFunction* FunctionPtr = FindUField<UFunction>(FunctionClass, TEXT("MakeAccessVariableParams"));
-		check(FunctionPtr);
-
-		FBlueprintCompiledStatement& Statement = Context.AppendStatementForNode(Node);
-		Statement.Type = KCST_CallFunction;
-		Statement.FunctionToCall = FunctionPtr;
-		Statement.bIsParentContext = false;
-		Statement.LHS = TermMap.FindRef("AccessVariableParamsTemp");
-		Statement.RHS.Add(TermMap.FindRef("bIncludeGenerationClass"));
-		Statement.RHS.Add(TermMap.FindRef("bExtendIfNotPresent"));
-	}
-
 	void CreateGetFunctionCallStatement(FKismetFunctionContext& Context, UK2Node_DynamicGetVariableByNameNode* Node)
 	{
 		UEdGraphPin* TargetPin = Node->GetTargetPin();
@@ -201,7 +182,12 @@ public:
 		Statement.bIsParentContext = false;
 		Statement.RHS.Add(TargetTerm);
 		Statement.RHS.Add(VarNameTerm);
-		Statement.RHS.Add(TermMap.FindRef("AccessVariableParamsTemp"));
+		if (Node->bUsePathArguments)
+		{
+			Statement.RHS.Add(Context.NetMap.FindRef(FEdGraphUtilities::GetNetFromPin(Node->GetIntArgumentsPin())));
+			Statement.RHS.Add(Context.NetMap.FindRef(FEdGraphUtilities::GetNetFromPin(Node->GetNameArgumentsPin())));
+		}
+		Statement.RHS.Add(TermMap.FindRef("AccessVariableParams"));
 		Statement.RHS.Add(SuccessTerm);
 		Statement.RHS.Add(ResultTerm);
 	}
@@ -211,7 +197,6 @@ public:
 		UK2Node_DynamicGetVariableByNameNode* DynamicGetVariableByNameNode =
 			CastChecked<UK2Node_DynamicGetVariableByNameNode>(Node);
 
-		CreateMakeStructStatement(Context, DynamicGetVariableByNameNode);
 		CreateGetFunctionCallStatement(Context, DynamicGetVariableByNameNode);
 
 		if (!DynamicGetVariableByNameNode->bPureNode)
@@ -335,7 +320,8 @@ void UK2Node_DynamicGetVariableByNameNode::AllocateDefaultPins()
 	// 1: Execution Triggering (In, Exec)
 	// 2: Execution Then (Out, Exec)
 	// 3: Target (In, Object Reference)
-	// 4: Var Name (In, FName)
+	// 4: Var Name (In, FName or FString)
+	// -: Int Arguments, Name Arguments (In, Array, only if bUsePathArguments is true)
 	// 5: Success (Out, Boolean)
 	// 6-: Result (Out, *)
 
@@ -347,6 +333,10 @@ void UK2Node_DynamicGetVariableByNameNode::AllocateDefaultPins()
 	}
 	CreateTargetPin();
 	CreateVarNamePin();
+	if (bUsePathArguments)
+	{
+		CreateArgumentPins();
+	}
 	CreateSuccessPin();
 
 	FEdGraphPinType InitialPinType = VariantPinType;
@@ -383,6 +373,10 @@ void UK2Node_DynamicGetVariableByNameNode::ReallocatePinsDuringReconstruction(TA
 	}
 	CreateTargetPin();
 	CreateVarNamePin();
+	if (bUsePathArguments)
+	{
+		CreateArgumentPins();
+	}
 	CreateSuccessPin();
 
 	// [Backward compatibility] Change pin type to the previous result pin type.
@@ -452,7 +446,24 @@ void UK2Node_DynamicGetVariableByNameNode::CreateFunctionPin()
 	FCreatePinParams Params;
 	Params.Index = 0;
 
-	if (bPureNode)
+	if (bPureNode && bUsePathArguments)
+	{
+		InternalCallFuncName =
+			GET_FUNCTION_NAME_CHECKED(UVariableGetterFunctionLibarary, GetNestedVariableByNameWithArgumentsPure);
+	}
+	else if (bUsePathArguments)
+	{
+		InternalCallFuncName = GET_FUNCTION_NAME_CHECKED(UVariableGetterFunctionLibarary, GetNestedVariableByNameWithArguments);
+	}
+	else if (bPureNode && bStringVarName)
+	{
+		InternalCallFuncName = GET_FUNCTION_NAME_CHECKED(UVariableGetterFunctionLibarary, GetNestedVariableByStringPure);
+	}
+	else if (bStringVarName)
+	{
+		InternalCallFuncName = GET_FUNCTION_NAME_CHECKED(UVariableGetterFunctionLibarary, GetNestedVariableByString);
+	}
+	else if (bPureNode)
 	{
 		InternalCallFuncName = GET_FUNCTION_NAME_CHECKED(UVariableGetterFunctionLibarary, GetNestedVariableByNamePure);
 	}
@@ -513,10 +524,23 @@ void UK2Node_DynamicGetVariableByNameNode::CreateVarNamePin()
 {
 	FCreatePinParams Params;
 	Params.Index = 4;
-	UEdGraphPin* Pin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Name, VarNamePinName, Params);
+	const FName PinCategory = bStringVarName && !bUsePathArguments ? UEdGraphSchema_K2::PC_String : UEdGraphSchema_K2::PC_Name;
+	UEdGraphPin* Pin = CreatePin(EGPD_Input, PinCategory, VarNamePinName, Params);
 	Pin->PinFriendlyName = FText::AsCultureInvariant(VarNamePinFriendlyName);
 }
 
+void UK2Node_DynamicGetVariableByNameNode::CreateArgumentPins()
+{
+	FCreatePinParams Params;
+	Params.ContainerType = EPinContainerType::Array;
+
+	UEdGraphPin* IntArgumentsPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Int, IntArgumentsPinName, Params);
+	IntArgumentsPin->PinFriendlyName = FText::AsCultureInvariant(IntArgumentsPinFriendlyName);
+
+	UEdGraphPin* NameArgumentsPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Name, NameArgumentsPinName, Params);
+	NameArgumentsPin->PinFriendlyName = FText::AsCultureInvariant(NameArgumentsPinFriendlyName);
+}
+
 void UK2Node_DynamicGetVariableByNameNode::CreateSuccessPin()
 {
 	FCreatePinParams Params;
@@ -609,6 +633,16 @@ UEdGraphPin* UK2Node_DynamicGetVariableByNameNode::GetVarNamePin() const
 	return FindPinChecked(VarNamePinName);
 }
 
+UEdGraphPin* UK2Node_DynamicGetVariableByNameNode::GetIntArgumentsPin() const
+{
+	return FindPin(IntArgumentsPinName);
+}
+
+UEdGraphPin* UK2Node_DynamicGetVariableByNameNode::GetNameArgumentsPin() const
+{
+	return FindPin(NameArgumentsPinName);
+}
+
 UEdGraphPin* UK2Node_DynamicGetVariableByNameNode::GetSuccessPin() const
 {
 	return FindPinChecked(SuccessPinName);
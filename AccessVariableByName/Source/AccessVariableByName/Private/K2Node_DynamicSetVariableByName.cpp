@@ -85,6 +85,13 @@ public:
 					{
 						RegisterLiteral(Context, Pin);
 					}
+					else if (Pin == Node->GetIntArgumentsPin() || Pin == Node->GetNameArgumentsPin())
+					{
+						// Unlinked arguments are passed as empty arrays.
+						FString NewName = FString::Format(TEXT("{0}_{1}"), {*Node->GetName(), *Pin->PinName.ToString()});
+						FBPTerminal* Term = Context.CreateLocalTerminalFromPinAutoChooseScope(Pin, NewName);
+						Context.NetMap.Add(Pin, Term);
+					}
 				}
 			}
 
@@ -100,29 +107,20 @@ public:
 		}
 	}
 
-	void RegisterTemporaryNets(FKismetFunctionContext& Context, UK2Node_DynamicSetVariableByNameNode* Node)
+	void RegisterParameterNets(FKismetFunctionContext& Context, UK2Node_DynamicSetVariableByNameNode* Node)
 	{
-		FBPTerminal* AccessVariableParams = Context.CreateLocalTerminal();
+		// Parameters are known at compile time, so pass them as a struct literal instead of building them on every access.
+		FBPTerminal* AccessVariableParams = Context.CreateLocalTerminal(ETerminalSpecification::TS_Literal);
+		AccessVariableParams->bIsLiteral = true;
 		AccessVariableParams->Type.PinCategory = UEdGraphSchema_K2::PC_Struct;
 		AccessVariableParams->Type.PinSubCategoryObject = FAccessVariableParams::StaticStruct();
-		AccessVariableParams->Name = Context.NetNameMap->MakeValidName(Node, TEXT("AccessVariableParamsTemp"));
+		FAccessVariableParams Params;
+		Params.bIncludeGenerationClass = Node->bIncludeGenerationClass;
+		Params.bCacheObjectChain = Node->bCacheObjectChain;
+		Params.bExtendIfNotPresent = Node->bExtendIfNotPresent;
+		AccessVariableParams->Name = MakeAccessVariableParamsLiteral(Params);
 		AccessVariableParams->Source = Node;
-		TermMap.Add("AccessVariableParamsTemp", AccessVariableParams);
-	}
-
-	void RegisterParameterNets(FKismetFunctionContext& Context, UK2Node_DynamicSetVariableByNameNode* Node)
-	{
-		FBPTerminal* IncludeGenerationClass = Context.CreateLocalTerminal(ETerminalSpecification::TS_Literal);
-		IncludeGenerationClass->bIsLiteral = true;
-		IncludeGenerationClass->Type.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-		IncludeGenerationClass->Name = Node->bIncludeGenerationClass ? TEXT("true") : TEXT("false");
-		TermMap.Add("bIncludeGenerationClass", IncludeGenerationClass);
-
-		FBPTerminal* ExtendIfNotPresent = Context.CreateLocalTerminal(ETerminalSpecification::TS_Literal);
-		ExtendIfNotPresent->bIsLiteral = true;
-		ExtendIfNotPresent->Type.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-		ExtendIfNotPresent->Name = Node->bExtendIfNotPresent ? TEXT("true") : TEXT("false");
-		TermMap.Add("bExtendIfNotPresent", ExtendIfNotPresent);
+		TermMap.Add("AccessVariableParams", AccessVariableParams);
 	}
 
 	virtual void RegisterNets(FKismetFunctionContext& Context, UEdGraphNode* Node) override
@@ -133,25 +131,9 @@ public:
 		FNodeHandlingFunctor::RegisterNets(Context, Node);
 
 		RegisterNodePinNets(Context, DynamicSetVariableByNameNode);
-		RegisterTemporaryNets(Context, DynamicSetVariableByNameNode);
 		RegisterParameterNets(Context, DynamicSetVariableByNameNode);
 	}
 
-	void CreateMakeStructStatement(FKismetFunctionContext& Context, UK2Node_DynamicSetVariableByNameNode* Node)
-	{
-		UClass* FunctionClass = UVariableAccessUtilLibrary::StaticClass();
-		UFunction* FunctionPtr = FindUField<UFunction>(FunctionClass, TEXT("MakeAccessVariableParams"));
-		check(FunctionPtr);
-
-		FBlueprintCompiledStatement& Statement = Context.AppendStatementForNode(Node);
-		Statement.Type = KCST_CallFunction;
-		Statement.FunctionToCall = FunctionPtr;
-		Statement.bIsParentContext = false;
-		Statement.LHS = TermMap.FindRef("AccessVariableParamsTemp");
-		Statement.RHS.Add(TermMap.FindRef("bIncludeGenerationClass"));
-		Statement.RHS.Add(TermMap.FindRef("bExtendIfNotPresent"));
-	}
-
 	void CreateGetFunctionCallStatement(FKismetFunctionContext& Context, UK2Node_DynamicSetVariableByNameNode* Node)
 	{
 		UEdGraphPin* TargetPin = Node->GetTargetPin();
@@ -205,7 +187,12 @@ public:
 		CallFuncStatement.bIsParentContext = false;
 		CallFuncStatement.RHS.Add(TargetTerm);
 		CallFuncStatement.RHS.Add(VarNameTerm);
-		CallFuncStatement.RHS.Add(TermMap.FindRef("AccessVariableParamsTemp"));
+		if (Node->bUsePathArguments)
+		{
+			CallFuncStatement.RHS.Add(Context.NetMap.FindRef(FEdGraphUtilities::GetNetFromPin(Node->GetIntArgumentsPin())));
+			CallFuncStatement.RHS.Add(Context.NetMap.FindRef(FEdGraphUtilities::GetNetFromPin(Node->GetNameArgumentsPin())));
+		}
+		CallFuncStatement.RHS.Add(TermMap.FindRef("AccessVariableParams"));
 		CallFuncStatement.RHS.Add(SuccessTerm);
 		CallFuncStatement.RHS.Add(ResultTerm);
 		CallFuncStatement.RHS.Add(NewValueTerm);	// Argument order is different from pin index.
@@ -216,7 +203,6 @@ public:
 		UK2Node_DynamicSetVariableByNameNode* DynamicSetVariableByNameNode =
 			CastChecked<UK2Node_DynamicSetVariableByNameNode>(Node);
 
-		CreateMakeStructStatement(Context, DynamicSetVariableByNameNode);
 		CreateGetFunctionCallStatement(Context, DynamicSetVariableByNameNode);
 
 		UEdGraphPin* ExecThenPin = DynamicSetVariableByNameNode->GetExecThenPin();
@@ -329,7 +315,8 @@ void UK2Node_DynamicSetVariableByNameNode::AllocateDefaultPins()
 	// 1: Execution Triggering (In, Exec)
 	// 2: Execution Then (Out, Exec)
 	// 3: Target (In, Object Reference)
-	// 4: Var Name (In, FName)
+	// 4: Var Name (In, FName or FString)
+	// -: Int Arguments, Name Arguments (In, Array, only if bUsePathArguments is true)
 	// 5: Success (Out, Boolean)
 	// 6+(N*2): New Value (In, *)
 	// 6+(N*2)+1: Result (Out, *)
@@ -339,6 +326,10 @@ void UK2Node_DynamicSetVariableByNameNode::AllocateDefaultPins()
 	CreateExecThenPin();
 	CreateTargetPin();
 	CreateVarNamePin();
+	if (bUsePathArguments)
+	{
+		CreateArgumentPins();
+	}
 	CreateSuccessPin();
 
 	FEdGraphPinType InitialPinType = VariantPinType;
@@ -373,6 +364,10 @@ void UK2Node_DynamicSetVariableByNameNode::ReallocatePinsDuringReconstruction(TA
 	CreateExecThenPin();
 	CreateTargetPin();
 	CreateVarNamePin();
+	if (bUsePathArguments)
+	{
+		CreateArgumentPins();
+	}
 	CreateSuccessPin();
 
 	// [Backward compatibility] Change pin type to the previous result pin type.
@@ -429,6 +424,19 @@ void UK2Node_DynamicSetVariableByNameNode::CreateFunctionPin()
 	FCreatePinParams Params;
 	Params.Index = 0;
 
+	if (bUsePathArguments)
+	{
+		InternalCallFuncName = GET_FUNCTION_NAME_CHECKED(UVariableSetterFunctionLibarary, SetNestedVariableByNameWithArguments);
+	}
+	else if (bStringVarName)
+	{
+		InternalCallFuncName = GET_FUNCTION_NAME_CHECKED(UVariableSetterFunctionLibarary, SetNestedVariableByString);
+	}
+	else
+	{
+		InternalCallFuncName = GET_FUNCTION_NAME_CHECKED(UVariableSetterFunctionLibarary, SetNestedVariableByName);
+	}
+
 	UClass* FunctionClass = UVariableSetterFunctionLibarary::StaticClass();
 	UFunction* FunctionPtr = FunctionClass->FindFunctionByName(InternalCallFuncName);
 	check(FunctionPtr);
@@ -481,10 +489,23 @@ void UK2Node_DynamicSetVariableByNameNode::CreateVarNamePin()
 {
 	FCreatePinParams Params;
 	Params.Index = 4;
-	UEdGraphPin* Pin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Name, VarNamePinName, Params);
+	const FName PinCategory = bStringVarName && !bUsePathArguments ? UEdGraphSchema_K2::PC_String : UEdGraphSchema_K2::PC_Name;
+	UEdGraphPin* Pin = CreatePin(EGPD_Input, PinCategory, VarNamePinName, Params);
 	Pin->PinFriendlyName = FText::AsCultureInvariant(VarNamePinFriendlyName);
 }
 
+void UK2Node_DynamicSetVariableByNameNode::CreateArgumentPins()
+{
+	FCreatePinParams Params;
+	Params.ContainerType = EPinContainerType::Array;
+
+	UEdGraphPin* IntArgumentsPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Int, IntArgumentsPinName, Params);
+	IntArgumentsPin->PinFriendlyName = FText::AsCultureInvariant(IntArgumentsPinFriendlyName);
+
+	UEdGraphPin* NameArgumentsPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Name, NameArgumentsPinName, Params);
+	NameArgumentsPin->PinFriendlyName = FText::AsCultureInvariant(NameArgumentsPinFriendlyName);
+}
+
 void UK2Node_DynamicSetVariableByNameNode::CreateSuccessPin()
 {
 	FCreatePinParams Params;
@@ -590,6 +611,16 @@ UEdGraphPin* UK2Node_DynamicSetVariableByNameNode::GetVarNamePin() const
 	return FindPinChecked(VarNamePinName);
 }
 
+UEdGraphPin* UK2Node_DynamicSetVariableByNameNode::GetIntArgumentsPin() const
+{
+	return FindPin(IntArgumentsPinName);
+}
+
+UEdGraphPin* UK2Node_DynamicSetVariableByNameNode::GetNameArgumentsPin() const
+{
+	return FindPin(NameArgumentsPinName);
+}
+
 UEdGraphPin* UK2Node_DynamicSetVariableByNameNode::GetSuccessPin() const
 {
 	return FindPinChecked(SuccessPinName);
@@ -0,0 +1,587 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "K2Node_ForEachElementByName.h"
+
+#include "AccessVariableByNameUtils.h"
+#include "BlueprintNodeSpawner.h"
+#include "EditorCategoryUtils.h"
+#include "K2Node_AssignmentStatement.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_Self.h"
+#include "K2Node_TemporaryVariable.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "KismetCompiler.h"
+#include "VariableArrayFunctionLibrary.h"
+#include "VariableMapFunctionLibrary.h"
+
+#define LOCTEXT_NAMESPACE "K2Node"
+
+UK2Node_ForEachElementByNameNode::UK2Node_ForEachElementByNameNode(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UK2Node_ForEachElementByNameNode::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.ChangeType == EPropertyChangeType::Unspecified)
+	{
+		return;
+	}
+
+	RecreateElementPins();
+}
+
+FText UK2Node_ForEachElementByNameNode::GetMenuCategory() const
+{
+	return FEditorCategoryUtils::GetCommonCategory(FCommonEditorCategory::Variables);
+}
+
+void UK2Node_ForEachElementByNameNode::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+UK2Node_MakeStruct* UK2Node_ForEachElementByNameNode::CreateMakeStructNode(
+	FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	UK2Node_MakeStruct* MakeStruct = CompilerContext.SpawnIntermediateNode<UK2Node_MakeStruct>(this, SourceGraph);
+	MakeStruct->StructType = FAccessVariableParams::StaticStruct();
+	MakeStruct->AllocateDefaultPins();
+	MakeStruct->bMadeAfterOverridePinRemoval = true;
+	MakeStruct->GetSchema()->TrySetDefaultValue(
+		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bIncludeGenerationClass)),
+		bIncludeGenerationClass ? TEXT("true") : TEXT("false"));
+	MakeStruct->GetSchema()->TrySetDefaultValue(
+		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bExtendIfNotPresent)), TEXT("false"));
+
+	return MakeStruct;
+}
+
+UK2Node_CallFunction* UK2Node_ForEachElementByNameNode::CreateCallFunctionNode(
+	FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UClass* FunctionClass, FName FunctionName)
+{
+	UFunction* Function = FunctionClass->FindFunctionByName(FunctionName);
+	check(Function);
+
+	UK2Node_CallFunction* CallFunction = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	CallFunction->SetFromFunction(Function);
+	CallFunction->AllocateDefaultPins();
+
+	return CallFunction;
+}
+
+void UK2Node_ForEachElementByNameNode::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+#ifdef AVBN_FREE_VERSION
+	// clang-format off
+	CompilerContext.MessageLog.Error(*LOCTEXT("ForEachNotSupported",
+		"'For Each Element by Name' node is not supported on the free version. "
+		"Please consider to buy full version at Fab.")
+		.ToString());
+	// clang-format on
+	BreakAllNodeLinks();
+#else
+	UEdGraphPin* TargetPin = GetTargetPin();
+	UEdGraphPin* VarNamePin = GetVarNamePin();
+	UEdGraphPin* ElementPin = GetElementPin();
+	UEdGraphPin* KeyPin = GetKeyPin();
+
+	if (VarNamePin->LinkedTo.Num() != 0)
+	{
+		CompilerContext.MessageLog.Error(
+			*LOCTEXT("InvalidForEachVarNameInput", "Var Name pin only supports literal value.").ToString());
+		return;
+	}
+	if (ElementPin == nullptr && KeyPin == nullptr)
+	{
+		CompilerContext.MessageLog.Error(
+			*LOCTEXT("InvalidForEachVarName", "Var Name must be a name of Array or Map variable. @@").ToString(), this);
+		return;
+	}
+
+	const bool bIsMap = KeyPin != nullptr;
+
+	// Create intermidiate nodes which access the container.
+	// The container is resolved once before the loop, and each iteration only indexes the resolved container.
+	UK2Node_MakeStruct* MakeStruct = CreateMakeStructNode(CompilerContext, SourceGraph);
+	UK2Node_CallFunction* ViewFunction = nullptr;
+	UK2Node_CallFunction* ElementFunction = nullptr;
+	UEdGraphPin* ElementIndexPin = nullptr;
+	if (bIsMap)
+	{
+		UClass* FunctionClass = UVariableMapFunctionLibrary::StaticClass();
+		ViewFunction = CreateCallFunctionNode(CompilerContext, SourceGraph, FunctionClass,
+			GET_FUNCTION_NAME_CHECKED(UVariableMapFunctionLibrary, MapViewByName));
+		ElementFunction = CreateCallFunctionNode(CompilerContext, SourceGraph, FunctionClass,
+			GET_FUNCTION_NAME_CHECKED(UVariableMapFunctionLibrary, MapGetPairByView));
+		ElementIndexPin = ElementFunction->FindPinChecked(TEXT("PairIndex"));
+	}
+	else
+	{
+		UClass* FunctionClass = UVariableArrayFunctionLibrary::StaticClass();
+		ViewFunction = CreateCallFunctionNode(CompilerContext, SourceGraph, FunctionClass,
+			GET_FUNCTION_NAME_CHECKED(UVariableArrayFunctionLibrary, ArrayViewByName));
+		ElementFunction = CreateCallFunctionNode(CompilerContext, SourceGraph, FunctionClass,
+			GET_FUNCTION_NAME_CHECKED(UVariableArrayFunctionLibrary, ArrayGetByView));
+		ElementIndexPin = ElementFunction->FindPinChecked(TEXT("Index"));
+	}
+
+	// Link target, var name and params pins of the function which resolves the container.
+	UEdGraphPin* FunctionTargetPin = ViewFunction->FindPinChecked(TEXT("Target"));
+	if (TargetPin->LinkedTo.Num() == 0)
+	{
+		// Handle self node case.
+		UK2Node_Self* SelfNode = CompilerContext.SpawnIntermediateNode<UK2Node_Self>(this, SourceGraph);
+		SelfNode->AllocateDefaultPins();
+		SelfNode->Pins[0]->MakeLinkTo(FunctionTargetPin);
+	}
+	else
+	{
+		CompilerContext.MovePinLinksToIntermediate(*TargetPin, *FunctionTargetPin);
+	}
+	ViewFunction->FindPinChecked(TEXT("VarName"))->DefaultValue = VarNamePin->DefaultValue;
+	MakeStruct->FindPinChecked(TEXT("AccessVariableParams"))->MakeLinkTo(ViewFunction->FindPinChecked(TEXT("Params")));
+	ViewFunction->FindPinChecked(TEXT("View"))->MakeLinkTo(ElementFunction->FindPinChecked(TEXT("View")));
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *ViewFunction->GetExecPin());
+
+	// Create the loop counter, and initialize it.
+	UK2Node_TemporaryVariable* LoopCounter = CompilerContext.SpawnIntermediateNode<UK2Node_TemporaryVariable>(this, SourceGraph);
+	LoopCounter->VariableType.PinCategory = UEdGraphSchema_K2::PC_Int;
+	LoopCounter->AllocateDefaultPins();
+	UEdGraphPin* LoopCounterPin = LoopCounter->GetVariablePin();
+
+	UK2Node_AssignmentStatement* LoopCounterInitialize =
+		CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+	LoopCounterInitialize->AllocateDefaultPins();
+	LoopCounterInitialize->GetValuePin()->DefaultValue = TEXT("0");
+	LoopCounterPin->MakeLinkTo(LoopCounterInitialize->GetVariablePin());
+	ViewFunction->GetThenPin()->MakeLinkTo(LoopCounterInitialize->GetExecPin());
+
+	// Loop while the counter is less than the bound of the container, which is taken before the loop.
+	UK2Node_CallFunction* Condition = CreateCallFunctionNode(CompilerContext, SourceGraph, UKismetMathLibrary::StaticClass(),
+		GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, Less_IntInt));
+	LoopCounterPin->MakeLinkTo(Condition->FindPinChecked(TEXT("A")));
+	ViewFunction->GetReturnValuePin()->MakeLinkTo(Condition->FindPinChecked(TEXT("B")));
+
+	UK2Node_IfThenElse* LoopBranch = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+	LoopBranch->AllocateDefaultPins();
+	LoopCounterInitialize->GetThenPin()->MakeLinkTo(LoopBranch->GetExecPin());
+	Condition->GetReturnValuePin()->MakeLinkTo(LoopBranch->GetConditionPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetCompletedPin(), *LoopBranch->GetElsePin());
+
+	// Copy only the current element, and skip the element which can not be acquired (e.g. hole of the map).
+	LoopBranch->GetThenPin()->MakeLinkTo(ElementFunction->GetExecPin());
+	LoopCounterPin->MakeLinkTo(ElementIndexPin);
+
+	UK2Node_IfThenElse* ElementBranch = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+	ElementBranch->AllocateDefaultPins();
+	ElementFunction->GetThenPin()->MakeLinkTo(ElementBranch->GetExecPin());
+	ElementFunction->FindPinChecked(TEXT("Success"))->MakeLinkTo(ElementBranch->GetConditionPin());
+
+	UK2Node_ExecutionSequence* Sequence = CompilerContext.SpawnIntermediateNode<UK2Node_ExecutionSequence>(this, SourceGraph);
+	Sequence->AllocateDefaultPins();
+	ElementBranch->GetThenPin()->MakeLinkTo(Sequence->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetLoopBodyPin(), *Sequence->GetThenPinGivenIndex(0));
+
+	// Increment the loop counter.
+	UK2Node_CallFunction* Increment = CreateCallFunctionNode(CompilerContext, SourceGraph, UKismetMathLibrary::StaticClass(),
+		GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, Add_IntInt));
+	LoopCounterPin->MakeLinkTo(Increment->FindPinChecked(TEXT("A")));
+	Increment->FindPinChecked(TEXT("B"))->DefaultValue = TEXT("1");
+
+	UK2Node_AssignmentStatement* LoopCounterAssign =
+		CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+	LoopCounterAssign->AllocateDefaultPins();
+	Sequence->GetThenPinGivenIndex(1)->MakeLinkTo(LoopCounterAssign->GetExecPin());
+	ElementBranch->GetElsePin()->MakeLinkTo(LoopCounterAssign->GetExecPin());
+	LoopCounterPin->MakeLinkTo(LoopCounterAssign->GetVariablePin());
+	Increment->GetReturnValuePin()->MakeLinkTo(LoopCounterAssign->GetValuePin());
+	LoopCounterAssign->GetThenPin()->MakeLinkTo(LoopBranch->GetExecPin());
+
+	// Link element pins.
+	if (bIsMap)
+	{
+		UEdGraphPin* ValuePin = GetValuePin();
+		UEdGraphPin* FunctionKeyPin = ElementFunction->FindPinChecked(TEXT("Key"));
+		UEdGraphPin* FunctionValuePin = ElementFunction->FindPinChecked(TEXT("Value"));
+		FunctionKeyPin->PinType = KeyPin->PinType;
+		FunctionValuePin->PinType = ValuePin->PinType;
+
+		CompilerContext.MovePinLinksToIntermediate(*KeyPin, *FunctionKeyPin);
+		CompilerContext.MovePinLinksToIntermediate(*ValuePin, *FunctionValuePin);
+	}
+	else
+	{
+		UEdGraphPin* FunctionItemPin = ElementFunction->FindPinChecked(TEXT("Item"));
+		FunctionItemPin->PinType = ElementPin->PinType;
+
+		CompilerContext.MovePinLinksToIntermediate(*ElementPin, *FunctionItemPin);
+		CompilerContext.MovePinLinksToIntermediate(*GetArrayIndexPin(), *LoopCounterPin);
+	}
+
+	BreakAllNodeLinks();
+#endif
+}
+
+void UK2Node_ForEachElementByNameNode::AllocateDefaultPins()
+{
+	// Pin structure
+	// -----
+	// 0: Execution Triggering (In, Exec)
+	// 1: Target (In, Object Reference)
+	// 2: Var Name (In, FName)
+	// 3: Loop Body (Out, Exec)
+	// 4-5: Element, Array Index (Out, *, Integer) or Key, Value (Out, *, *)
+	// 6: Completed (Out, Exec)
+
+	CreateExecTriggeringPin();
+	CreateTargetPin();
+	CreateVarNamePin();
+	CreateLoopBodyPin();
+	CreateCompletedPin();
+
+	Super::AllocateDefaultPins();
+}
+
+void UK2Node_ForEachElementByNameNode::ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins)
+{
+	UEdGraphPin* OldTargetPin = nullptr;
+	UEdGraphPin* OldVarNamePin = nullptr;
+
+	for (auto& Pin : OldPins)
+	{
+		if (Pin->GetFName() == UEdGraphSchema_K2::PN_Self)
+		{
+			OldTargetPin = Pin;
+		}
+		else if (Pin->GetFName() == VarNamePinName)
+		{
+			OldVarNamePin = Pin;
+		}
+	}
+
+	AllocateDefaultPins();
+
+	if (OldTargetPin == nullptr || OldVarNamePin == nullptr)
+	{
+		RestoreSplitPins(OldPins);
+		return;
+	}
+
+	UClass* TargetClass = GetTargetClass(OldTargetPin);
+	FString VarName = OldVarNamePin->DefaultValue;
+	RecreateElementPinsInternal(TargetClass, VarName);
+
+	RestoreSplitPins(OldPins);
+}
+
+FText UK2Node_ForEachElementByNameNode::GetTooltipText() const
+{
+	return LOCTEXT("ForEachElementByNameNode_Tooltip",
+		"Loop over each element of an Array or Map variable specified by name.\nOnly the current element is copied.");
+}
+
+FText UK2Node_ForEachElementByNameNode::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("For Each Element by Name", "For Each Element by Name");
+}
+
+FSlateIcon UK2Node_ForEachElementByNameNode::GetIconAndTint(FLinearColor& OutColor) const
+{
+	static FSlateIcon Icon("EditorStyle", "GraphEditor.Macro.ForEach_16x");
+
+	return Icon;
+}
+
+void UK2Node_ForEachElementByNameNode::PinDefaultValueChanged(UEdGraphPin* Pin)
+{
+	if (Pin == nullptr)
+	{
+		return;
+	}
+
+	if (Pin->PinName == UEdGraphSchema_K2::PN_Self)
+	{
+		RecreateElementPins();
+	}
+	else if (Pin->PinName == VarNamePinName)
+	{
+		for (auto& ElementPin : Pins)
+		{
+			if (IsElementPin(ElementPin))
+			{
+				ElementPin->BreakAllPinLinks();
+			}
+		}
+		RecreateElementPins();
+	}
+}
+
+void UK2Node_ForEachElementByNameNode::PinConnectionListChanged(UEdGraphPin* Pin)
+{
+	if (Pin == nullptr)
+	{
+		return;
+	}
+
+	if (Pin->PinName == UEdGraphSchema_K2::PN_Self)
+	{
+		RecreateElementPins();
+	}
+}
+
+void UK2Node_ForEachElementByNameNode::CreateExecTriggeringPin()
+{
+	FCreatePinParams Params;
+	Params.Index = 0;
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute, Params);
+}
+
+void UK2Node_ForEachElementByNameNode::CreateTargetPin()
+{
+	FCreatePinParams Params;
+	Params.Index = 1;
+	UEdGraphPin* Pin =
+		CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, UObject::StaticClass(), UEdGraphSchema_K2::PN_Self, Params);
+	Pin->PinFriendlyName = FText::AsCultureInvariant(TargetPinFriendlyName);
+}
+
+void UK2Node_ForEachElementByNameNode::CreateVarNamePin()
+{
+	FCreatePinParams Params;
+	Params.Index = 2;
+	UEdGraphPin* Pin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Name, VarNamePinName, Params);
+	Pin->PinFriendlyName = FText::AsCultureInvariant(VarNamePinFriendlyName);
+}
+
+void UK2Node_ForEachElementByNameNode::CreateLoopBodyPin()
+{
+	FCreatePinParams Params;
+	Params.Index = 3;
+	UEdGraphPin* Pin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, LoopBodyPinName, Params);
+	Pin->PinFriendlyName = FText::AsCultureInvariant(LoopBodyPinFriendlyName);
+}
+
+void UK2Node_ForEachElementByNameNode::CreateCompletedPin()
+{
+	FCreatePinParams Params;
+	Params.Index = 4;
+	UEdGraphPin* Pin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, CompletedPinName, Params);
+	Pin->PinFriendlyName = FText::AsCultureInvariant(CompletedPinFriendlyName);
+}
+
+void UK2Node_ForEachElementByNameNode::CreateElementPins(FProperty* ContainerProperty)
+{
+	const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+	if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(ContainerProperty))
+	{
+		FEdGraphPinType ElementPinType;
+		Schema->ConvertPropertyToPinType(ArrayProperty->Inner, ElementPinType);
+
+		FCreatePinParams ElementParams;
+		ElementParams.Index = 4;
+		UEdGraphPin* Pin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Boolean, ElementPinName, ElementParams);
+		Pin->PinFriendlyName = FText::AsCultureInvariant(ElementPinFriendlyName);
+		Pin->PinType = ElementPinType;
+
+		FCreatePinParams IndexParams;
+		IndexParams.Index = 5;
+		Pin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Int, ArrayIndexPinName, IndexParams);
+		Pin->PinFriendlyName = FText::AsCultureInvariant(ArrayIndexPinFriendlyName);
+	}
+	else if (FMapProperty* MapProperty = CastField<FMapProperty>(ContainerProperty))
+	{
+		FEdGraphPinType KeyPinType;
+		Schema->ConvertPropertyToPinType(MapProperty->KeyProp, KeyPinType);
+		FEdGraphPinType ValuePinType;
+		Schema->ConvertPropertyToPinType(MapProperty->ValueProp, ValuePinType);
+
+		FCreatePinParams KeyParams;
+		KeyParams.Index = 4;
+		UEdGraphPin* Pin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Boolean, KeyPinName, KeyParams);
+		Pin->PinFriendlyName = FText::AsCultureInvariant(KeyPinFriendlyName);
+		Pin->PinType = KeyPinType;
+
+		FCreatePinParams ValueParams;
+		ValueParams.Index = 5;
+		Pin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Boolean, ValuePinName, ValueParams);
+		Pin->PinFriendlyName = FText::AsCultureInvariant(ValuePinFriendlyName);
+		Pin->PinType = ValuePinType;
+	}
+}
+
+void UK2Node_ForEachElementByNameNode::RecreateElementPinsInternal(UClass* TargetClass, const FString& VarName)
+{
+	if (TargetClass == nullptr)
+	{
+		return;
+	}
+
+	TArray<FString> Vars;
+	FVariableAccessFunctionLibraryUtils::SplitVarName(VarName, &Vars);
+	TArray<FVarDescription> VarDescs;
+	FVariableAccessFunctionLibraryUtils::AnalyzeVarNames(Vars, &VarDescs);
+
+	FAccessVariableParams Params;
+	Params.bIncludeGenerationClass = bIncludeGenerationClass;
+	TerminalProperty TP = GetTerminalProperty(VarDescs, 0, TargetClass, Params);
+	if (TP.Property != nullptr && TP.ContainerType == EPinContainerType::None)
+	{
+		CreateElementPins(TP.Property);
+	}
+}
+
+void UK2Node_ForEachElementByNameNode::RecreateElementPins()
+{
+	Modify();
+
+	TArray<UEdGraphPin*> UnusedPins = MoveTemp(Pins);
+	for (int32 Index = 0; Index < UnusedPins.Num(); ++Index)
+	{
+		UEdGraphPin* OldPin = UnusedPins[Index];
+		if (!IsElementPin(OldPin))
+		{
+			UnusedPins.RemoveAt(Index--, 1, false);
+			Pins.Add(OldPin);
+		}
+	}
+
+	// Create new element pins.
+	UClass* TargetClass = GetTargetClass();
+	FString VarName = GetVarNamePin()->DefaultValue;
+	RecreateElementPinsInternal(TargetClass, VarName);
+
+	// Restore connection.
+	RestoreSplitPins(UnusedPins);
+	RewireOldPinsToNewPins(UnusedPins, Pins, nullptr);
+
+	UEdGraph* Graph = GetGraph();
+	Graph->NotifyGraphChanged();
+}
+
+UClass* UK2Node_ForEachElementByNameNode::GetTargetClass(UEdGraphPin* Pin)
+{
+	UClass* TargetClass = nullptr;
+	UEdGraphPin* TargetPin = Pin;
+
+	if (TargetPin == nullptr)
+	{
+		TargetPin = GetTargetPin();
+	}
+
+	if (TargetPin == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (TargetPin->PinName == UEdGraphSchema_K2::PN_Self && TargetPin->LinkedTo.Num() == 0)
+	{
+		UEdGraphNode* OwningNode = TargetPin->GetOwningNode();
+		UClass* Class = GetClassFromNode(OwningNode);
+		if (Class != nullptr)
+		{
+			TargetClass = Class;
+		}
+	}
+	else if (TargetPin->LinkedTo.Num() > 0)
+	{
+		UEdGraphPin* LinkedPin = TargetPin->LinkedTo[0];
+		if (LinkedPin != nullptr)
+		{
+			if (LinkedPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Object && LinkedPin->PinType.PinSubCategory == "self")
+			{
+				UEdGraphNode* OwningNode = LinkedPin->GetOwningNode();
+				UK2Node_Self* SelfNode = CastChecked<UK2Node_Self>(OwningNode);
+				UClass* Class = GetClassFromNode(SelfNode);
+				if (Class != nullptr)
+				{
+					TargetClass = Class;
+				}
+			}
+			else
+			{
+				TargetClass = Cast<UClass>(LinkedPin->PinType.PinSubCategoryObject.Get());
+			}
+		}
+	}
+
+	if (TargetClass)
+	{
+		UBlueprint* Blueprint = Cast<UBlueprint>(TargetClass->ClassGeneratedBy);
+		if (Blueprint != nullptr && Blueprint->SkeletonGeneratedClass)
+		{
+			TargetClass = Blueprint->SkeletonGeneratedClass;
+		}
+	}
+
+	return TargetClass;
+}
+
+bool UK2Node_ForEachElementByNameNode::IsElementPin(const UEdGraphPin* Pin) const
+{
+	FName PinName = Pin->GetFName();
+
+	return PinName == ElementPinName || PinName == ArrayIndexPinName || PinName == KeyPinName || PinName == ValuePinName;
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetTargetPin() const
+{
+	return FindPin(UEdGraphSchema_K2::PN_Self);
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetVarNamePin() const
+{
+	return FindPinChecked(VarNamePinName);
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetLoopBodyPin() const
+{
+	return FindPinChecked(LoopBodyPinName);
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetCompletedPin() const
+{
+	return FindPinChecked(CompletedPinName);
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetElementPin() const
+{
+	return FindPin(ElementPinName);
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetArrayIndexPin() const
+{
+	return FindPin(ArrayIndexPinName);
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetKeyPin() const
+{
+	return FindPin(KeyPinName);
+}
+
+UEdGraphPin* UK2Node_ForEachElementByNameNode::GetValuePin() const
+{
+	return FindPin(ValuePinName);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -95,6 +95,9 @@ UK2Node_MakeStruct* UK2Node_GetVariableByNameNode::CreateMakeStructNode(
 	MakeStruct->GetSchema()->TrySetDefaultValue(
 		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bIncludeGenerationClass)),
 		bIncludeGenerationClass ? TEXT("true") : TEXT("false"));
+	MakeStruct->GetSchema()->TrySetDefaultValue(
+		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bCacheObjectChain)),
+		bCacheObjectChain ? TEXT("true") : TEXT("false"));
 	MakeStruct->GetSchema()->TrySetDefaultValue(
 		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bExtendIfNotPresent)), TEXT("false"));
 
@@ -152,6 +155,24 @@ void UK2Node_GetVariableByNameNode::ExpandNode(FKismetCompilerContext& CompilerC
 		return;
 	}
 
+	if (bThreadSafe)
+	{
+		TArray<FString> Vars;
+		FVariableAccessFunctionLibraryUtils::SplitVarName(VarNamePin->DefaultValue, &Vars);
+		TArray<FVarDescription> VarDescs;
+		FVariableAccessFunctionLibraryUtils::AnalyzeVarNames(Vars, &VarDescs);
+		if (!bPureNode || bIncludeGenerationClass || !IsPathWithinTarget(VarDescs, GetTargetClass()))
+		{
+			// clang-format off
+			CompilerContext.MessageLog.Error(*LOCTEXT("NotThreadSafe",
+				"Thread Safe requires Pure Node, and the variable which is reached only through structure members of the "
+				"target. @@")
+				.ToString(), this);
+			// clang-format on
+			return;
+		}
+	}
+
 	// Create intermidiate nodes.
 	UK2Node_MakeStruct* MakeStruct = CreateMakeStructNode(CompilerContext, SourceGraph);
 	UK2Node_CallFunction* CallFunction = CreateGetFunctionCallNode(CompilerContext, SourceGraph, ResultPin);
@@ -507,6 +528,11 @@ UFunction* UK2Node_GetVariableByNameNode::FindGetterFunction(UEdGraphPin* Pin)
 {
 	UClass* FunctionLibrary = UVariableGetterFunctionLibarary::StaticClass();
 
+	if (bPureNode && bThreadSafe)
+	{
+		return FunctionLibrary->FindFunctionByName(
+			GET_FUNCTION_NAME_CHECKED(UVariableGetterFunctionLibarary, GetNestedVariableByNameThreadSafe));
+	}
 	if (bPureNode)
 	{
 		return FunctionLibrary->FindFunctionByName(
@@ -95,6 +95,9 @@ UK2Node_MakeStruct* UK2Node_SetVariableByNameNode::CreateMakeStructNode(
 	MakeStruct->GetSchema()->TrySetDefaultValue(
 		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bIncludeGenerationClass)),
 		bIncludeGenerationClass ? TEXT("true") : TEXT("false"));
+	MakeStruct->GetSchema()->TrySetDefaultValue(
+		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bCacheObjectChain)),
+		bCacheObjectChain ? TEXT("true") : TEXT("false"));
 	MakeStruct->GetSchema()->TrySetDefaultValue(
 		*MakeStruct->FindPinChecked(GET_MEMBER_NAME_STRING_CHECKED(FAccessVariableParams, bExtendIfNotPresent)),
 		bExtendIfNotPresent ? TEXT("true") : TEXT("false"));
@@ -14,10 +14,16 @@
 #define LOCTEXT_NAMESPACE "FAccessVariableByNameModule"
 
 class FGraphPanelNodeFactory_AccessVariableByName;
+class FStructChangedListener_AccessVariableByName;
 
 class FAccessVariableByNameModule : public IModuleInterface
 {
 	TSharedPtr<FGraphPanelNodeFactory_AccessVariableByName> GraphPanelNodeFactory_AccessVariableByName;
+	FDelegateHandle PostEngineInitHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	TSharedPtr<FStructChangedListener_AccessVariableByName> StructChangedListener;
+
+	void OnPostEngineInit();
 
 public:
 	virtual void StartupModule() override;
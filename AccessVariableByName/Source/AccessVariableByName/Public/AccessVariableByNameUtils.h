@@ -17,12 +17,28 @@ extern const FName ExtendIfNotPresentPinName;
 extern const FName SuccessPinName;
 extern const FName ResultPinNamePrefix;
 extern const FName NewValuePinNamePrefix;
+extern const FName LoopBodyPinName;
+extern const FName ElementPinName;
+extern const FName ArrayIndexPinName;
+extern const FName KeyPinName;
+extern const FName ValuePinName;
+extern const FName CompletedPinName;
+extern const FName IntArgumentsPinName;
+extern const FName NameArgumentsPinName;
 
 extern const FString ExecThenPinFriendlyName;
 extern const FString TargetPinFriendlyName;
 extern const FString VarNamePinFriendlyName;
 extern const FString ExtendIfNotPresentPinFriendlyName;
 extern const FString SuccessPinFriendlyName;
+extern const FString LoopBodyPinFriendlyName;
+extern const FString ElementPinFriendlyName;
+extern const FString ArrayIndexPinFriendlyName;
+extern const FString KeyPinFriendlyName;
+extern const FString ValuePinFriendlyName;
+extern const FString CompletedPinFriendlyName;
+extern const FString IntArgumentsPinFriendlyName;
+extern const FString NameArgumentsPinFriendlyName;
 
 struct TerminalProperty
 {
@@ -32,5 +48,7 @@ struct TerminalProperty
 
 FEdGraphPinType CreateDefaultPinType();
 UClass* GetClassFromNode(const UEdGraphNode* Node);
+FString MakeAccessVariableParamsLiteral(const FAccessVariableParams& Params);
 TerminalProperty GetTerminalProperty(
 	const TArray<FVarDescription>& VarDescs, int32 VarDepth, UClass* OuterClass, const FAccessVariableParams& Params);
+ACCESSVARIABLEBYNAME_API bool IsPathWithinTarget(const TArray<FVarDescription>& VarDescs, UClass* TargetClass);
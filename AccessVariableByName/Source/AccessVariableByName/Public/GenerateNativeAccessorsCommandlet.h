@@ -0,0 +1,32 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "GenerateNativeAccessorsCommandlet.generated.h"
+
+// Generate a source file of the native accessors, which the accesses by name dispatch to (see FVarAccessNativeAccessor).
+//   UnrealEditor-Cmd Game.uproject -run=GenerateNativeAccessors -Blueprints -Output=Source/Game/NativeAccessors.cpp
+// -Blueprints     Collect the literal paths of the Get/Set Variable by Name nodes in the Blueprints under /Game.
+// -Paths=A:B,...  Class path and variable path (e.g. /Script/Engine.Actor:PrimaryActorTick.TickInterval).
+// -PathsFile=F    Same as -Paths with one entry per line. The lines starting with '#' are ignored.
+// -Output=F       Source file to generate, which is relative to the project directory.
+UCLASS()
+class UGenerateNativeAccessorsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGenerateNativeAccessorsCommandlet(const FObjectInitializer& ObjectInitializer);
+
+	// Override from UCommandlet
+	virtual int32 Main(const FString& Params) override;
+};
@@ -46,6 +46,7 @@ protected:
 	void CreateExecThenPin();
 	void CreateTargetPin();
 	void CreateVarNamePin();
+	void CreateArgumentPins();
 	void CreateSuccessPin();
 	void CreateNewValuePin(const FEdGraphPinType& PinType, int32 Index);
 	void CreateResultPin(const FEdGraphPinType& PinType, int32 Index);
@@ -64,6 +65,8 @@ public:
 	UEdGraphPin* GetExecThenPin() const;
 	UEdGraphPin* GetTargetPin() const;
 	UEdGraphPin* GetVarNamePin() const;
+	UEdGraphPin* GetIntArgumentsPin() const;
+	UEdGraphPin* GetNameArgumentsPin() const;
 	UEdGraphPin* GetSuccessPin() const;
 	TArray<UEdGraphPin*> GetAllNewValuePins() const;
 	TArray<UEdGraphPin*> GetAllResultPins() const;
@@ -75,6 +78,19 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
 	bool bIncludeGenerationClass = false;
 
+	// Remember the intermediate objects of the path per target if true, so that repeated accesses skip to the last object.
+	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
+	bool bCacheObjectChain = false;
+
+	// Substitute placeholders in Var Name with the argument pins if true (e.g. Slots[{0}] or Buffs["{0}"]).
+	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
+	bool bUsePathArguments = false;
+
+	// Pass Var Name as a string, so that the generated names are not added to the name table.
+	// Ignored when path arguments are used.
+	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
+	bool bStringVarName = false;
+
 	// Access float variable as a single precision float variable.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Access Variable Options")
 	bool bSinglePrecision = false;
@@ -0,0 +1,76 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "K2Node.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_MakeStruct.h"
+
+#include "K2Node_ForEachElementByName.generated.h"
+
+UCLASS(MinimalAPI)
+class UK2Node_ForEachElementByNameNode : public UK2Node
+{
+	GENERATED_BODY()
+
+protected:
+	// Override from UObject
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+
+	// Override from UK2Node
+	virtual FText GetMenuCategory() const override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+
+	// Override from UEdGraphNode
+	virtual void AllocateDefaultPins() override;
+	virtual void ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins) override;
+	virtual FText GetTooltipText() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FSlateIcon GetIconAndTint(FLinearColor& OutColor) const override;
+	virtual void PinDefaultValueChanged(UEdGraphPin* Pin) override;
+	virtual void PinConnectionListChanged(UEdGraphPin* Pin) override;
+	virtual bool ShouldShowNodeProperties() const override
+	{
+		return true;
+	}
+
+	// Internal
+	void CreateExecTriggeringPin();
+	void CreateTargetPin();
+	void CreateVarNamePin();
+	void CreateLoopBodyPin();
+	void CreateCompletedPin();
+	void CreateElementPins(FProperty* ContainerProperty);
+	void RecreateElementPins();
+	void RecreateElementPinsInternal(UClass* TargetClass, const FString& VarName);
+	UClass* GetTargetClass(UEdGraphPin* Pin = nullptr);
+	bool IsElementPin(const UEdGraphPin* Pin) const;
+	UK2Node_MakeStruct* CreateMakeStructNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph);
+	UK2Node_CallFunction* CreateCallFunctionNode(
+		FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UClass* FunctionClass, FName FunctionName);
+
+public:
+	UK2Node_ForEachElementByNameNode(const FObjectInitializer& ObjectInitializer);
+
+	UEdGraphPin* GetTargetPin() const;
+	UEdGraphPin* GetVarNamePin() const;
+	UEdGraphPin* GetLoopBodyPin() const;
+	UEdGraphPin* GetCompletedPin() const;
+	UEdGraphPin* GetElementPin() const;
+	UEdGraphPin* GetArrayIndexPin() const;
+	UEdGraphPin* GetKeyPin() const;
+	UEdGraphPin* GetValuePin() const;
+
+	// Include variables from a generation class (UBlueprint) if true.
+	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
+	bool bIncludeGenerationClass = false;
+};
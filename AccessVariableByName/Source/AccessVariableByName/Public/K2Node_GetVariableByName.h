@@ -78,7 +78,16 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Node Options")
 	bool bPureNode = true;
 
+	// Use the thread safe getter if true, so that the node can be evaluated on animation worker threads.
+	// Requires Pure Node, and the variable which is reached only through structure members of the target.
+	UPROPERTY(EditAnywhere, Category = "Node Options")
+	bool bThreadSafe = false;
+
 	// Include variables from a generation class (UBlueprint) if true.
 	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
 	bool bIncludeGenerationClass = false;
+
+	// Remember the intermediate objects of the path per target if true, so that repeated accesses skip to the last object.
+	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
+	bool bCacheObjectChain = false;
 };
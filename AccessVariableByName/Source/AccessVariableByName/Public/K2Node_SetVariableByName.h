@@ -77,6 +77,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
 	bool bIncludeGenerationClass = false;
 
+	// Remember the intermediate objects of the path per target if true, so that repeated accesses skip to the last object.
+	UPROPERTY(EditAnywhere, Category = "Access Variable Options")
+	bool bCacheObjectChain = false;
+
 	// Create elements automatically if true when the element does not present.
 	UPROPERTY(EditAnywhere, Category = "Container Type Access Options")
 	bool bExtendIfNotPresent = false;
@@ -0,0 +1,69 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "PathCore/VarAccessPath.h"
+
+namespace VarAccessPath
+{
+template <typename CharType>
+void Tokenize(const CharType* Path, size_t Length, std::vector<FToken>* OutTokens)
+{
+	for (FToken Token = NextToken(Path, Length, 0); Token.Length > 0;
+		 Token = NextToken(Path, Length, Token.Offset + Token.Length + 1))
+	{
+		OutTokens->push_back(Token);
+	}
+}
+
+template <typename CharType>
+TSegment<CharType> ParseSegment(const CharType* Segment, size_t Length)
+{
+	const TSegmentView<CharType> View = ScanSegment(Segment, Length);
+
+	TSegment<CharType> Result;
+	Result.bIsValid = View.bIsValid;
+	if (!View.bIsValid)
+	{
+		return Result;
+	}
+
+	Result.Name.assign(View.Name, View.NameLength);
+	Result.IndexType = View.IndexType;
+	Result.Integer = View.Integer;
+	if (View.String != nullptr)
+	{
+		Result.String.assign(View.String, View.StringLength);
+	}
+	Result.ArgumentIndex = View.ArgumentIndex;
+
+	return Result;
+}
+
+template <typename CharType>
+void Parse(const CharType* Path, size_t Length, std::vector<TSegment<CharType>>* OutSegments)
+{
+	for (FToken Token = NextToken(Path, Length, 0); Token.Length > 0;
+		 Token = NextToken(Path, Length, Token.Offset + Token.Length + 1))
+	{
+		OutSegments->push_back(ParseSegment(Path + Token.Offset, Token.Length));
+	}
+}
+
+template void Tokenize<char>(const char*, size_t, std::vector<FToken>*);
+template TSegment<char> ParseSegment<char>(const char*, size_t);
+template void Parse<char>(const char*, size_t, std::vector<TSegment<char>>*);
+
+template void Tokenize<wchar_t>(const wchar_t*, size_t, std::vector<FToken>*);
+template TSegment<wchar_t> ParseSegment<wchar_t>(const wchar_t*, size_t);
+template void Parse<wchar_t>(const wchar_t*, size_t, std::vector<TSegment<wchar_t>>*);
+
+template void Tokenize<char16_t>(const char16_t*, size_t, std::vector<FToken>*);
+template TSegment<char16_t> ParseSegment<char16_t>(const char16_t*, size_t);
+template void Parse<char16_t>(const char16_t*, size_t, std::vector<TSegment<char16_t>>*);
+}	 // namespace VarAccessPath
@@ -0,0 +1,88 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableAccessAsync.h"
+
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+
+#include "UObject/UnrealType.h"
+
+namespace FVariableAccessAsync
+{
+bool IsThreadSafeRead(UObject* Target, FName VarName, const FAccessVariableParams& Params)
+{
+	// The generation class is looked up through the Blueprint object.
+	if (Target == nullptr || Params.bIncludeGenerationClass)
+	{
+		return false;
+	}
+
+	TArray<FVarDescription> VarDescs;
+	if (!FVariableAccessFunctionLibraryUtils::ParseVarName(VarName.ToString(), &VarDescs) || VarDescs.Num() == 0)
+	{
+		return false;
+	}
+
+	UScriptStruct* OuterStruct = nullptr;
+	for (int32 VarDepth = 0; VarDepth < VarDescs.Num(); ++VarDepth)
+	{
+		const FVarDescription& Desc = VarDescs[VarDepth];
+		if (!Desc.bIsValid || Desc.ArrayAccessType != EArrayAccessType::ArrayAccessType_None)
+		{
+			return false;
+		}
+
+		FProperty* Property = nullptr;
+		if (OuterStruct == nullptr)
+		{
+			Property = FVariableAccessFunctionLibraryUtils::FindClassProperty(Target->GetClass(), Desc.Name);
+		}
+		else
+		{
+			Property = FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(OuterStruct, Desc.VarName);
+		}
+		if (Property == nullptr)
+		{
+			return false;
+		}
+
+		if (VarDepth == VarDescs.Num() - 1)
+		{
+			return Property->HasAnyPropertyFlags(CPF_IsPlainOldData) && !Property->IsA<FObjectPropertyBase>();
+		}
+
+		FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		if (StructProperty == nullptr)
+		{
+			return false;
+		}
+		OuterStruct = StructProperty->Struct;
+	}
+
+	return false;
+}
+
+TTuple<FProperty*, void*> ResolveVariable(UObject* Target, FName VarName, const FAccessVariableParams& Params)
+{
+	if (Target == nullptr)
+	{
+		return TTuple<FProperty*, void*>(nullptr, nullptr);
+	}
+
+	TArray<FVarDescription> VarDescs;
+	if (!FVariableAccessFunctionLibraryUtils::ParseVarName(VarName.ToString(), &VarDescs))
+	{
+		return TTuple<FProperty*, void*>(nullptr, nullptr);
+	}
+
+	return FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(VarDescs, 0, Target, nullptr, Params);
+}
+}	 // namespace FVariableAccessAsync
+
+#endif
@@ -9,14 +9,29 @@
 
 #include "VariableAccessFunctionLibraryModule.h"
 
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UObjectGlobals.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+
 #define LOCTEXT_NAMESPACE "FVariableAccessFunctionLibrary"
 
 void FVariableAccessFunctionLibraryModule::StartupModule()
 {
+	// Cached properties may belong to the classes which were destroyed or reloaded.
+	PostGarbageCollectHandle =
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FVariableAccessFunctionLibraryUtils::InvalidateCaches);
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+		[](EReloadCompleteReason Reason) { FVariableAccessFunctionLibraryUtils::InvalidateCaches(); });
+#endif
 }
 
 void FVariableAccessFunctionLibraryModule::ShutdownModule()
 {
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#endif
 }
 
 bool FVariableAccessFunctionLibraryModule::SupportsDynamicReloading()
@@ -1,4 +1,4 @@
-/*!
+﻿/*!
  * AccessVariableByName
  *
  * Copyright (c) 2022 Colory Games
@@ -9,10 +9,15 @@
 
 #include "VariableAccessFunctionLibraryUtils.h"
 
-#include "Internationalization/Regex.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeRWLock.h"
+#include "PathCore/VarAccessPathCache.h"
 #include "UObject/TextProperty.h"
 #include "UObject/UnrealType.h"
+#include "VariableAccessNativeAccessors.h"
+#include "VariableAccessThreadSafe.h"
+
+#include <atomic>
 
 FAccessVariableParams UVariableAccessUtilLibrary::MakeAccessVariableParams(bool bIncludeGenerationClass, bool bExtendIfNotPresent)
 {
@@ -26,10 +31,12 @@ FAccessVariableParams UVariableAccessUtilLibrary::MakeAccessVariableParams(bool
 
 namespace FVariableAccessFunctionLibraryUtils
 {
-bool HandleTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, FStructProperty* OuterProperty,
-	void* OuterAddr, FProperty* Dest, void* DestAddr, FProperty* NewValue, void* NewValueAddr, const FAccessVariableParams& Params);
-bool HandleTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, UObject* OuterObject, FProperty* Dest,
-	void* DestAddr, FProperty* NewValue, void* NewValueAddr, const FAccessVariableParams& Params);
+TTuple<FProperty*, void*> ResolveTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth,
+	FStructProperty* OuterProperty, void* OuterAddr, FProperty* ExpectedProperty, const FAccessVariableParams& Params,
+	FVarAccessLink* Links);
+
+// Incremented when the resolved properties may be stale (e.g. Blueprint recompilation, hot reload or garbage collection).
+std::atomic<uint32> CacheEpoch(1);
 
 void* GetInnerItemAddrFromArray(FArrayProperty* ArrayProperty, void* OuterAddr, int32 Index, bool bExtendIfNotPresent)
 {
@@ -38,6 +45,7 @@ void* GetInnerItemAddrFromArray(FArrayProperty* ArrayProperty, void* OuterAddr,
 
 	if (!ArrayHelper.IsValidIndex(Index) && bExtendIfNotPresent && (Index >= 0))
 	{
+		FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
 		ArrayHelper.ExpandForIndex(Index);
 	}
 	if (!ArrayHelper.IsValidIndex(Index))
@@ -48,110 +56,156 @@ void* GetInnerItemAddrFromArray(FArrayProperty* ArrayProperty, void* OuterAddr,
 	return ArrayHelper.GetRawPtr(Index);
 }
 
-template <typename T>
-T* GetKeyAddrFromMap(FMapProperty* MapProperty, void* OuterAddr, T Key)
+// Lookup tables built per struct on the first access, which are shared among threads.
+// The signature detects the layout change of the struct which is recompiled in place before the cache epoch changes.
+template <typename IndexType>
+class TStructIndexCache
 {
-	void* MapAddr = MapProperty->ContainerPtrToValuePtr<void>(OuterAddr);
-	auto MapPtr = MapProperty->GetPropertyValuePtr(MapAddr);
-	FScriptMapHelper MapHelper(MapProperty, MapAddr);
+public:
+	using FIndexPtr = TSharedPtr<const IndexType, ESPMode::ThreadSafe>;
 
-	for (FScriptMapHelper::FIterator MapIt = MapHelper.CreateIterator(); MapIt; ++MapIt)
+	template <typename BuildFunctionType>
+	FIndexPtr FindOrBuild(const UStruct* Struct, uint32 Signature, BuildFunctionType&& Build)
 	{
-#if !UE_VERSION_OLDER_THAN(5, 4, 0)
-		T* KeyPtr = (T*) MapHelper.GetKeyPtr(MapIt.GetInternalIndex());
-#else
-		T* KeyPtr = (T*) MapHelper.GetKeyPtr(*MapIt);
-#endif
-		T ActualKey = *KeyPtr;
-		if (Key == ActualKey)
+		const uint32 Epoch = CacheEpoch.load();
+		{
+			FReadScopeLock ReadLock(Lock);
+			const FEntry* Entry = IndicesEpoch == Epoch ? Indices.Find(Struct) : nullptr;
+			if (Entry != nullptr && Entry->Signature == Signature)
+			{
+				return Entry->Index;
+			}
+		}
+
+		TSharedRef<IndexType, ESPMode::ThreadSafe> NewIndex = MakeShared<IndexType, ESPMode::ThreadSafe>();
+		Build(*NewIndex);
+
+		// The index built before the latest epoch change is used only for this lookup.
+		FWriteScopeLock WriteLock(Lock);
+		if (CacheEpoch.load() != Epoch)
+		{
+			return NewIndex;
+		}
+		if (IndicesEpoch != Epoch)
 		{
-			return KeyPtr;
+			Indices.Reset();
+			IndicesEpoch = Epoch;
 		}
+		FEntry& Entry = Indices.FindOrAdd(Struct);
+		Entry.Signature = Signature;
+		Entry.Index = NewIndex;
+
+		return NewIndex;
 	}
 
-	return nullptr;
-}
+private:
+	struct FEntry
+	{
+		uint32 Signature = 0;
+		FIndexPtr Index;
+	};
 
-template <>
-FName* GetKeyAddrFromMap<FName>(FMapProperty* MapProperty, void* OuterAddr, FName Key)
-{
-	void* MapAddr = MapProperty->ContainerPtrToValuePtr<void>(OuterAddr);
-	auto MapPtr = MapProperty->GetPropertyValuePtr(MapAddr);
-	FScriptMapHelper MapHelper(MapProperty, MapAddr);
+	FRWLock Lock;
+	TMap<const UStruct*, FEntry> Indices;
+	uint32 IndicesEpoch = 0;
+};
 
-	for (FScriptMapHelper::FIterator MapIt = MapHelper.CreateIterator(); MapIt; ++MapIt)
+uint32 GetStructLayoutSignature(const UStruct* Struct)
+{
+	uint32 Signature = 0;
+	for (; Struct != nullptr; Struct = Struct->GetSuperStruct())
 	{
-#if !UE_VERSION_OLDER_THAN(5, 4, 0)
-		FName* KeyPtr = (FName*) MapHelper.GetKeyPtr(MapIt.GetInternalIndex());
-#else
-		FName* KeyPtr = (FName*) MapHelper.GetKeyPtr(*MapIt);
-#endif
-		FString KeyString = Key.ToString();
-		FString ActualKeyString = KeyPtr->ToString();
-		if (KeyString == ActualKeyString)
-		{
-			return KeyPtr;
-		}
+		Signature = HashCombine(Signature, PointerHash(Struct->ChildProperties));
+		Signature = HashCombine(Signature, GetTypeHash(Struct->GetPropertiesSize()));
 	}
 
-	return nullptr;
+	return Signature;
 }
 
-template <typename T>
-void* GetValueAddrFromMap(FMapProperty* MapProperty, void* OuterAddr, T Key, bool bExtendIfNotPresent)
+// Authored names are compared case sensitively, as FString::Equals does.
+struct FAuthoredNameKeyFuncs : BaseKeyFuncs<TPair<FString, FProperty*>, FString, false>
 {
-	void* MapAddr = MapProperty->ContainerPtrToValuePtr<void>(OuterAddr);
-	auto MapPtr = MapProperty->GetPropertyValuePtr(MapAddr);
-	FScriptMapHelper MapHelper(MapProperty, MapAddr);
-	T* KeyAddr = GetKeyAddrFromMap(MapProperty, OuterAddr, Key);
-	if (KeyAddr == nullptr && !bExtendIfNotPresent)
+	static const FString& GetSetKey(const TPair<FString, FProperty*>& Element)
 	{
-		return nullptr;
+		return Element.Key;
 	}
 
-	if (bExtendIfNotPresent)
+	static bool Matches(const FString& A, const FString& B)
 	{
-		return MapHelper.FindOrAdd(&Key);
+		return A.Equals(B, ESearchCase::CaseSensitive);
 	}
 
-	return MapHelper.FindValueFromHash(KeyAddr);
-}
+	static uint32 GetKeyHash(const FString& Key)
+	{
+		return FCrc::StrCrc32(*Key);
+	}
+};
 
-FProperty* GetScriptStructProperty(UScriptStruct* ScriptStruct, FString VarName)
-{
-	FProperty* Property = nullptr;
+// Members of a user defined struct by the authored name, since their internal names have a GUID suffix.
+using FStructNameIndex = TMap<FString, FProperty*, FDefaultSetAllocator, FAuthoredNameKeyFuncs>;
 
-	if (ScriptStruct->IsNative())
+TStructIndexCache<FStructNameIndex> StructNameIndices;
+
+// All properties of a class including the inherited ones. The property of the subclass hides the one of the superclass.
+using FClassPropertyTable = TMap<FName, FProperty*>;
+
+TStructIndexCache<FClassPropertyTable> ClassPropertyTables;
+
+FProperty* FindClassProperty(const UClass* Class, FName VarName)
+{
+	if (Class == nullptr)
 	{
-		Property = ScriptStruct->FindPropertyByName(*VarName);
+		return nullptr;
 	}
-	else
-	{
-		FField* Field = ScriptStruct->ChildProperties;
-		while (Field)
-		{
-			FString FieldName = Field->GetName();
-			FString PropertyName = Field->GetAuthoredName();
 
-			if (PropertyName.Equals(VarName))
+	TSharedPtr<const FClassPropertyTable, ESPMode::ThreadSafe> Table = ClassPropertyTables.FindOrBuild(Class,
+		GetStructLayoutSignature(Class),
+		[Class](FClassPropertyTable& NewTable)
+		{
+			for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
 			{
-				Property = ScriptStruct->FindPropertyByName(*FieldName);
-				break;
+				if (NewTable.Find(It->GetFName()) == nullptr)
+				{
+					NewTable.Add(It->GetFName(), *It);
+				}
 			}
+		});
+	FProperty* const* Property = Table->Find(VarName);
 
-			Field = Field->Next;
-		}
+	return Property != nullptr ? *Property : nullptr;
+}
+
+FProperty* GetScriptStructProperty(UScriptStruct* ScriptStruct, const FString& VarName)
+{
+	if (ScriptStruct->IsNative())
+	{
+		return ScriptStruct->FindPropertyByName(*VarName);
 	}
 
-	return Property;
+	TSharedPtr<const FStructNameIndex, ESPMode::ThreadSafe> Index = StructNameIndices.FindOrBuild(ScriptStruct,
+		GetStructLayoutSignature(ScriptStruct),
+		[ScriptStruct](FStructNameIndex& NewIndex)
+		{
+			for (FField* Field = ScriptStruct->ChildProperties; Field != nullptr; Field = Field->Next)
+			{
+				FProperty* Property = CastField<FProperty>(Field);
+				if (Property != nullptr && NewIndex.Find(Field->GetAuthoredName()) == nullptr)
+				{
+					NewIndex.Add(Field->GetAuthoredName(), Property);
+				}
+			}
+		});
+	FProperty* const* Property = Index->Find(VarName);
+
+	return Property != nullptr ? *Property : nullptr;
 }
 
-TTuple<FProperty*, UObject*> GetObjectProperty(UObject* Object, FString VarName, bool bFindGeneratedBy)
+TTuple<FProperty*, UObject*> GetObjectProperty(UObject* Object, FName VarName, bool bFindGeneratedBy)
 {
 	const TTuple<FProperty*, UObject*> NullReturn(nullptr, nullptr);
 
 	UClass* TargetClass = Object->GetClass();
-	FProperty* Property = FindFProperty<FProperty>(TargetClass, *VarName);
+	FProperty* Property = FindClassProperty(TargetClass, VarName);
 	if (Property != nullptr)
 	{
 		return TTuple<FProperty*, UObject*>(Property, Object);
@@ -166,7 +220,7 @@ TTuple<FProperty*, UObject*> GetObjectProperty(UObject* Object, FString VarName,
 			return NullReturn;
 		}
 
-		Property = FindFProperty<FProperty>(Blueprint->GetClass(), *VarName);
+		Property = FindClassProperty(Blueprint->GetClass(), VarName);
 		if (Property == nullptr)
 		{
 			return NullReturn;
@@ -179,415 +233,864 @@ TTuple<FProperty*, UObject*> GetObjectProperty(UObject* Object, FString VarName,
 	return NullReturn;
 }
 
-bool HandleTerminalPropertyInternal(const TArray<FVarDescription>& VarDescs, int32 VarDepth, FProperty* Property, void* OuterAddr,
-	FProperty* Dest, void* DestAddr, FProperty* NewValue, void* NewValueAddr, const FAccessVariableParams& Params)
+bool InitializeMapKey(FProperty* KeyProperty, void* KeyAddr, const FVarDescription& Desc)
 {
-	if (VarDescs.Num() <= VarDepth)
+	if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_Integer)
 	{
-		return false;
-	}
-
-	const FVarDescription& Desc = VarDescs[VarDepth];
+		if (!KeyProperty->IsA<FByteProperty>() && !KeyProperty->IsA<FIntProperty>() && !KeyProperty->IsA<FInt64Property>())
+		{
+			return false;
+		}
 
-	if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_None)
+		CastFieldChecked<FNumericProperty>(KeyProperty)->SetIntPropertyValue(KeyAddr, (int64) Desc.ArrayAccessValue.Integer);
+		return true;
+	}
+	else if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_String)
 	{
-		if (VarDescs.Num() == VarDepth + 1)
+		if (KeyProperty->IsA<FStrProperty>())
 		{
-			if (!Property->SameType(Dest))
-			{
-				return false;
-			}
-
-			void* SrcAddr = Property->ContainerPtrToValuePtr<void>(OuterAddr);
-			if (NewValue != nullptr)
-			{
-				Property->CopyCompleteValue(SrcAddr, NewValueAddr);
-			}
-			Property->CopyCompleteValue(DestAddr, SrcAddr);
+			CastFieldChecked<FStrProperty>(KeyProperty)->SetPropertyValue(KeyAddr, Desc.ArrayAccessValue.String);
 			return true;
 		}
-
-		if (Property->IsA<FStructProperty>())
+		else if (KeyProperty->IsA<FNameProperty>())
 		{
-			FStructProperty* StructProperty = CastFieldChecked<FStructProperty>(Property);
-			void* StructAddr = Property->ContainerPtrToValuePtr<void>(OuterAddr);
-
-			return HandleTerminalProperty(
-				VarDescs, VarDepth + 1, StructProperty, StructAddr, Dest, DestAddr, NewValue, NewValueAddr, Params);
+			CastFieldChecked<FNameProperty>(KeyProperty)->SetPropertyValue(KeyAddr, FName(*Desc.ArrayAccessValue.String));
+			return true;
 		}
-		else if (Property->IsA<FObjectProperty>())
-		{
-			FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(Property);
-			UObject* Object = ObjectProperty->GetPropertyValue_InContainer(OuterAddr);
-			void* ObjectAddr = ObjectProperty->ContainerPtrToValuePtr<void>(OuterAddr);
+	}
 
-			return HandleTerminalProperty(VarDescs, VarDepth + 1, Object, Dest, DestAddr, NewValue, NewValueAddr, Params);
-		}
+	return false;
+}
 
-		return false;
+void* GetMapValueAddr(FMapProperty* MapProperty, void* OuterAddr, const FVarDescription& Desc, bool bExtendIfNotPresent)
+{
+	FProperty* KeyProperty = MapProperty->KeyProp;
+
+	// Build the key with the map's key type, so that the value can be found by the hash.
+	void* KeyAddr = FMemory_Alloca(KeyProperty->GetSize());
+	KeyProperty->InitializeValue(KeyAddr);
+	if (!InitializeMapKey(KeyProperty, KeyAddr, Desc))
+	{
+		KeyProperty->DestroyValue(KeyAddr);
+		return nullptr;
 	}
-	else if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_Integer)
+
+	void* MapAddr = MapProperty->ContainerPtrToValuePtr<void>(OuterAddr);
+	FScriptMapHelper MapHelper(MapProperty, MapAddr);
+
+	void* ValueAddr = nullptr;
+	if (bExtendIfNotPresent)
 	{
-		if (Property->IsA<FArrayProperty>())
-		{
-			FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Property);
-			FProperty* InnerProperty = ArrayProperty->Inner;
+		FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+		ValueAddr = MapHelper.FindOrAdd(KeyAddr);
+	}
+	else
+	{
+		ValueAddr = MapHelper.FindValueFromHash(KeyAddr);
+	}
+	KeyProperty->DestroyValue(KeyAddr);
 
-			if (VarDescs.Num() == VarDepth + 1)
-			{
-				if (!InnerProperty->SameType(Dest))
-				{
-					return false;
-				}
+	return ValueAddr;
+}
 
-				void* InnerItemAddr =
-					GetInnerItemAddrFromArray(ArrayProperty, OuterAddr, Desc.ArrayAccessValue.Integer, Params.bExtendIfNotPresent);
-				if (InnerItemAddr == nullptr)
-				{
-					return false;
-				}
+bool IsTraversableProperty(FProperty* Property)
+{
+	return Property->IsA<FStructProperty>() || Property->IsA<FObjectProperty>();
+}
 
-				if (NewValue != nullptr)
-				{
-					Dest->CopyCompleteValue(InnerItemAddr, NewValueAddr);
-				}
-				Dest->CopyCompleteValue(DestAddr, InnerItemAddr);
+TTuple<FProperty*, void*> ResolveNextProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, FProperty* Property,
+	void* ValueAddr, FProperty* ExpectedProperty, const FAccessVariableParams& Params, FVarAccessLink* Links)
+{
+	if (Property->IsA<FStructProperty>())
+	{
+		FStructProperty* StructProperty = CastFieldChecked<FStructProperty>(Property);
 
-				return true;
-			}
+		return ResolveTerminalProperty(VarDescs, VarDepth, StructProperty, ValueAddr, ExpectedProperty, Params, Links);
+	}
+	else if (Property->IsA<FObjectProperty>())
+	{
+		FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(Property);
+		UObject* Object = ObjectProperty->GetPropertyValue(ValueAddr);
 
-			if (InnerProperty->IsA<FStructProperty>())
-			{
-				void* InnerItemAddr =
-					GetInnerItemAddrFromArray(ArrayProperty, OuterAddr, Desc.ArrayAccessValue.Integer, Params.bExtendIfNotPresent);
-				if (InnerItemAddr == nullptr)
-				{
-					return false;
-				}
+		return ResolveTerminalProperty(VarDescs, VarDepth, Object, ExpectedProperty, Params, Links);
+	}
 
-				FStructProperty* StructProperty = CastFieldChecked<FStructProperty>(InnerProperty);
+	return TTuple<FProperty*, void*>(nullptr, nullptr);
+}
 
-				return HandleTerminalProperty(
-					VarDescs, VarDepth + 1, StructProperty, InnerItemAddr, Dest, DestAddr, NewValue, NewValueAddr, Params);
-			}
-			else if (InnerProperty->IsA<FObjectProperty>())
-			{
-				void* InnerItemAddr =
-					GetInnerItemAddrFromArray(ArrayProperty, OuterAddr, Desc.ArrayAccessValue.Integer, Params.bExtendIfNotPresent);
-				if (InnerItemAddr == nullptr)
-				{
-					return false;
-				}
+TTuple<FProperty*, void*> ResolveTerminalPropertyInternal(const TArray<FVarDescription>& VarDescs, int32 VarDepth,
+	FProperty* Property, void* OuterAddr, FProperty* ExpectedProperty, const FAccessVariableParams& Params, FVarAccessLink* Links)
+{
+	const TTuple<FProperty*, void*> NullReturn(nullptr, nullptr);
 
-				FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(InnerProperty);
-				UObject* Object = ObjectProperty->GetPropertyValue_InContainer(InnerItemAddr);
+	if (VarDescs.Num() <= VarDepth)
+	{
+		return NullReturn;
+	}
 
-				return HandleTerminalProperty(VarDescs, VarDepth + 1, Object, Dest, DestAddr, NewValue, NewValueAddr, Params);
-			}
+	const FVarDescription& Desc = VarDescs[VarDepth];
+	const bool bIsTerminal = VarDescs.Num() == VarDepth + 1;
 
-			return false;
+	// Find the property which holds the value of this depth, and check it before touching the container.
+	FProperty* ValueProperty = nullptr;
+	if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_None)
+	{
+		ValueProperty = Property;
+	}
+	else if (Property->IsA<FArrayProperty>() && Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_Integer)
+	{
+		ValueProperty = CastFieldChecked<FArrayProperty>(Property)->Inner;
+	}
+	else if (Property->IsA<FMapProperty>())
+	{
+		ValueProperty = CastFieldChecked<FMapProperty>(Property)->ValueProp;
+	}
+	if (ValueProperty == nullptr)
+	{
+		return NullReturn;
+	}
+	if (bIsTerminal && ExpectedProperty != nullptr && !ValueProperty->SameType(ExpectedProperty))
+	{
+		return NullReturn;
+	}
+	if (!bIsTerminal && !IsTraversableProperty(ValueProperty))
+	{
+		return NullReturn;
+	}
+
+	void* ValueAddr = nullptr;
+	if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_None)
+	{
+		ValueAddr = Property->ContainerPtrToValuePtr<void>(OuterAddr);
+	}
+	else if (Property->IsA<FArrayProperty>())
+	{
+		FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Property);
+		ValueAddr = GetInnerItemAddrFromArray(ArrayProperty, OuterAddr, Desc.ArrayAccessValue.Integer, Params.bExtendIfNotPresent);
+	}
+	else
+	{
+		FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
+		ValueAddr = GetMapValueAddr(MapProperty, OuterAddr, Desc, Params.bExtendIfNotPresent);
+	}
+	if (ValueAddr == nullptr)
+	{
+		return NullReturn;
+	}
+
+	if (bIsTerminal)
+	{
+		return TTuple<FProperty*, void*>(ValueProperty, ValueAddr);
+	}
+
+	return ResolveNextProperty(VarDescs, VarDepth + 1, ValueProperty, ValueAddr, ExpectedProperty, Params, Links);
+}
+
+TTuple<FProperty*, void*> ResolveTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth,
+	FStructProperty* OuterProperty, void* OuterAddr, FProperty* ExpectedProperty, const FAccessVariableParams& Params,
+	FVarAccessLink* Links)
+{
+	const TTuple<FProperty*, void*> NullReturn(nullptr, nullptr);
+
+	if (VarDescs.Num() <= VarDepth)
+	{
+		return NullReturn;
+	}
+
+	const FVarDescription& Desc = VarDescs[VarDepth];
+
+	if (!Desc.bIsValid)
+	{
+		return NullReturn;
+	}
+
+	UScriptStruct* ScriptStruct = OuterProperty->Struct;
+	FVarAccessLink* Link = Links != nullptr ? &Links[VarDepth] : nullptr;
+	FProperty* Property = nullptr;
+	if (Link != nullptr && Link->Owner == ScriptStruct)
+	{
+		Property = Link->Property;
+	}
+	else
+	{
+		Property = GetScriptStructProperty(ScriptStruct, Desc.VarName);
+		// The missing member is remembered too, so that probing an absent variable does not search again.
+		if (Link != nullptr && Link->Owner == nullptr)
+		{
+			Link->Owner = ScriptStruct;
+			Link->Property = Property;
 		}
-		else if (Property->IsA<FMapProperty>())
+	}
+	if (Property == nullptr)
+	{
+		return NullReturn;
+	}
+
+	return ResolveTerminalPropertyInternal(VarDescs, VarDepth, Property, OuterAddr, ExpectedProperty, Params, Links);
+}
+
+TTuple<FProperty*, UObject*> GetObjectProperty(
+	UObject* Object, const FVarDescription& Desc, bool bFindGeneratedBy, FVarAccessLink* Link)
+{
+	UClass* TargetClass = Object->GetClass();
+	if (Link != nullptr && Link->Owner == TargetClass)
+	{
+		if (!Link->bGenerationClass)
 		{
-			FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
+			return TTuple<FProperty*, UObject*>(Link->Property, Object);
+		}
+#if WITH_EDITORONLY_DATA
+		return TTuple<FProperty*, UObject*>(Link->Property, Cast<UBlueprint>(TargetClass->ClassGeneratedBy));
+#endif
+	}
 
-			FProperty* KeyProperty = MapProperty->KeyProp;
-			FProperty* ValueProperty = MapProperty->ValueProp;
-			if (!KeyProperty->IsA<FByteProperty>() && !KeyProperty->IsA<FIntProperty>() && !KeyProperty->IsA<FInt64Property>())
-			{
-				return false;
-			}
+	TTuple<FProperty*, UObject*> Result = GetObjectProperty(Object, Desc.Name, bFindGeneratedBy);
+	// The missing variable is remembered too. The link is reset with the chain when the class is recompiled or reloaded.
+	if (Link != nullptr && Link->Owner == nullptr)
+	{
+		Link->Owner = TargetClass;
+		Link->Property = Result.Get<0>();
+		Link->bGenerationClass = Result.Get<0>() != nullptr && Result.Get<1>() != Object;
+	}
 
-			if (VarDescs.Num() == VarDepth + 1)
-			{
-				if (!ValueProperty->SameType(Dest))
-				{
-					return false;
-				}
+	return Result;
+}
 
-				void* ValueAddr =
-					GetValueAddrFromMap(MapProperty, OuterAddr, Desc.ArrayAccessValue.Integer, Params.bExtendIfNotPresent);
-				if (ValueAddr == nullptr)
-				{
-					return false;
-				}
+TTuple<FProperty*, void*> ResolveTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, UObject* OuterObject,
+	FProperty* ExpectedProperty, const FAccessVariableParams& Params, FVarAccessLink* Links)
+{
+	const TTuple<FProperty*, void*> NullReturn(nullptr, nullptr);
 
-				if (NewValue != nullptr)
-				{
-					Dest->CopyCompleteValue(ValueAddr, NewValueAddr);
-				}
-				Dest->CopyCompleteValue(DestAddr, ValueAddr);
+	if (VarDescs.Num() <= VarDepth)
+	{
+		return NullReturn;
+	}
 
-				return true;
-			}
+	const FVarDescription& Desc = VarDescs[VarDepth];
 
-			if (ValueProperty->IsA<FStructProperty>())
-			{
-				void* ValueAddr =
-					GetValueAddrFromMap(MapProperty, OuterAddr, Desc.ArrayAccessValue.Integer, Params.bExtendIfNotPresent);
-				if (ValueAddr == nullptr)
-				{
-					return false;
-				}
+	if (!Desc.bIsValid)
+	{
+		return NullReturn;
+	}
 
-				FStructProperty* StructProperty = CastFieldChecked<FStructProperty>(ValueProperty);
+	if (OuterObject == nullptr)
+	{
+		return NullReturn;
+	}
 
-				return HandleTerminalProperty(
-					VarDescs, VarDepth + 1, StructProperty, ValueAddr, Dest, DestAddr, NewValue, NewValueAddr, Params);
-			}
-			else if (ValueProperty->IsA<FObjectProperty>())
-			{
-				void* ValueAddr =
-					GetValueAddrFromMap(MapProperty, OuterAddr, Desc.ArrayAccessValue.Integer, Params.bExtendIfNotPresent);
-				if (ValueAddr == nullptr)
-				{
-					return false;
-				}
+	FVarAccessLink* Link = Links != nullptr ? &Links[VarDepth] : nullptr;
+	TTuple<FProperty*, UObject*> Result = GetObjectProperty(OuterObject, Desc, Params.bIncludeGenerationClass, Link);
+	if (Result.Get<0>() == nullptr || Result.Get<1>() == nullptr)
+	{
+		return NullReturn;
+	}
 
-				FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(ValueProperty);
-				UObject* Object = ObjectProperty->GetPropertyValue(ValueAddr);
+	return ResolveTerminalPropertyInternal(
+		VarDescs, VarDepth, Result.Get<0>(), Result.Get<1>(), ExpectedProperty, Params, Links);
+}
 
-				return HandleTerminalProperty(VarDescs, VarDepth + 1, Object, Dest, DestAddr, NewValue, NewValueAddr, Params);
-			}
+TTuple<FProperty*, void*> ResolveTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, UObject* OuterObject,
+	FProperty* ExpectedProperty, const FAccessVariableParams& Params)
+{
+	return ResolveTerminalProperty(VarDescs, VarDepth, OuterObject, ExpectedProperty, Params, nullptr);
+}
 
-			return false;
-		}
+bool CopyTerminalProperty(TTuple<FProperty*, void*> Terminal, void* DestAddr, FProperty* NewValue, void* NewValueAddr)
+{
+	FProperty* TerminalProperty = Terminal.Get<0>();
+	void* TerminalAddr = Terminal.Get<1>();
+	if (TerminalProperty == nullptr || TerminalAddr == nullptr || DestAddr == nullptr)
+	{
+		return false;
+	}
 
+	if (NewValue != nullptr)
+	{
+		TerminalProperty->CopyCompleteValue(TerminalAddr, NewValueAddr);
+	}
+	TerminalProperty->CopyCompleteValue(DestAddr, TerminalAddr);
+
+	return true;
+}
+
+bool HandleTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, UObject* OuterObject, FProperty* Dest,
+	void* DestAddr, FProperty* NewValue, void* NewValueAddr, const FAccessVariableParams& Params)
+{
+	// The expected property is optional only for the callers which resolve without copying.
+	if (Dest == nullptr || DestAddr == nullptr)
+	{
 		return false;
 	}
-	else if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_String)
+
+	TTuple<FProperty*, void*> Terminal = ResolveTerminalProperty(VarDescs, VarDepth, OuterObject, Dest, Params, nullptr);
+
+	return CopyTerminalProperty(Terminal, DestAddr, NewValue, NewValueAddr);
+}
+
+// Targets whose intermediate objects are remembered per chain.
+const int32 MaxObjectChains = 4;
+
+void BuildObjectHops(const FVarAccessChain& Chain, UObject* Target, TArray<FVarAccessObjectHop>* Hops)
+{
+	Hops->Reset();
+
+	// Only the members stored inline in the objects are followed, so that the slot addresses stay valid while the parents live.
+	const UStruct* Owner = Target->GetClass();
+	void* ContainerAddr = Target;
+	for (int32 VarDepth = 0; VarDepth + 1 < Chain.VarDescs.Num(); ++VarDepth)
 	{
-		if (!Property->IsA<FMapProperty>())
+		const FVarAccessLink& Link = Chain.Links[VarDepth];
+		if (Chain.VarDescs[VarDepth].ArrayAccessType != EArrayAccessType::ArrayAccessType_None || Link.Owner != Owner ||
+			Link.bGenerationClass)
 		{
-			return false;
+			return;
 		}
-		FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
 
-		FProperty* KeyProperty = MapProperty->KeyProp;
-		FProperty* ValueProperty = MapProperty->ValueProp;
-		if (!KeyProperty->IsA<FStrProperty>() && !KeyProperty->IsA<FNameProperty>() && !KeyProperty->IsA<FTextProperty>())
+		void* ValueAddr = Link.Property->ContainerPtrToValuePtr<void>(ContainerAddr);
+		if (FStructProperty* StructProperty = CastField<FStructProperty>(Link.Property))
 		{
-			return false;
+			Owner = StructProperty->Struct;
+			ContainerAddr = ValueAddr;
 		}
-
-		if (VarDescs.Num() == VarDepth + 1)
+		else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Link.Property))
 		{
-			if (!ValueProperty->SameType(Dest))
-			{
-				return false;
-			}
-
-			void* ValueAddr = GetValueAddrFromMap(MapProperty, OuterAddr, Desc.ArrayAccessValue.String, Params.bExtendIfNotPresent);
-			if (ValueAddr == nullptr)
+			UObject* Object = ObjectProperty->GetPropertyValue(ValueAddr);
+			if (Object == nullptr)
 			{
-				return false;
+				return;
 			}
 
-			if (NewValue != nullptr)
-			{
-				Dest->CopyCompleteValue(ValueAddr, NewValueAddr);
-			}
-			Dest->CopyCompleteValue(DestAddr, ValueAddr);
+			FVarAccessObjectHop& Hop = Hops->AddDefaulted_GetRef();
+			Hop.Property = ObjectProperty;
+			Hop.ValueAddr = ValueAddr;
+			Hop.Object = Object;
+			Hop.VarDepth = VarDepth + 1;
 
-			return true;
+			Owner = Object->GetClass();
+			ContainerAddr = Object;
 		}
+		else
+		{
+			return;
+		}
+	}
+}
 
-		if (ValueProperty->IsA<FStructProperty>())
+TTuple<FProperty*, void*> ResolveTerminalPropertyWithObjectChain(
+	FVarAccessChain* Chain, UObject* Target, FProperty* ExpectedProperty, const FAccessVariableParams& Params)
+{
+	FVarAccessObjectChain* ObjectChain =
+		Chain->ObjectChains.FindByPredicate([Target](const FVarAccessObjectChain& C) { return C.Target.Get() == Target; });
+	if (ObjectChain != nullptr)
+	{
+		// Each slot lives in the previous object, which is checked first.
+		UObject* Object = Target;
+		int32 VarDepth = 0;
+		bool bValid = true;
+		for (const FVarAccessObjectHop& Hop : ObjectChain->Hops)
 		{
-			void* ValueAddr = nullptr;
-			if (KeyProperty->IsA<FStrProperty>())
-			{
-				ValueAddr = GetValueAddrFromMap(MapProperty, OuterAddr, Desc.ArrayAccessValue.String, Params.bExtendIfNotPresent);
-			}
-			else if (KeyProperty->IsA<FNameProperty>())
+			UObject* HopObject = Hop.Object.Get();
+			if (HopObject == nullptr || Hop.Property->GetPropertyValue(Hop.ValueAddr) != HopObject)
 			{
-				ValueAddr =
-					GetValueAddrFromMap(MapProperty, OuterAddr, FName(*Desc.ArrayAccessValue.String), Params.bExtendIfNotPresent);
-			}
-			if (ValueAddr == nullptr)
-			{
-				return false;
+				bValid = false;
+				break;
 			}
+			Object = HopObject;
+			VarDepth = Hop.VarDepth;
+		}
+		if (bValid)
+		{
+			return ResolveTerminalProperty(Chain->VarDescs, VarDepth, Object, ExpectedProperty, Params, Chain->Links.GetData());
+		}
+	}
 
-			FStructProperty* StructProperty = CastFieldChecked<FStructProperty>(ValueProperty);
+	TTuple<FProperty*, void*> Terminal =
+		ResolveTerminalProperty(Chain->VarDescs, 0, Target, ExpectedProperty, Params, Chain->Links.GetData());
+	if (Terminal.Get<0>() == nullptr)
+	{
+		return Terminal;
+	}
 
-			return HandleTerminalProperty(
-				VarDescs, VarDepth + 1, StructProperty, ValueAddr, Dest, DestAddr, NewValue, NewValueAddr, Params);
+	if (ObjectChain == nullptr)
+	{
+		if (Chain->ObjectChains.Num() < MaxObjectChains)
+		{
+			ObjectChain = &Chain->ObjectChains.AddDefaulted_GetRef();
 		}
-		else if (ValueProperty->IsA<FObjectProperty>())
+		else
 		{
-			void* ValueAddr = nullptr;
-			if (KeyProperty->IsA<FStrProperty>())
-			{
-				ValueAddr =
-					GetValueAddrFromMap<FString>(MapProperty, OuterAddr, Desc.ArrayAccessValue.String, Params.bExtendIfNotPresent);
-			}
-			else if (KeyProperty->IsA<FNameProperty>())
-			{
-				ValueAddr = GetValueAddrFromMap<FName>(
-					MapProperty, OuterAddr, FName(*Desc.ArrayAccessValue.String), Params.bExtendIfNotPresent);
-			}
-			if (ValueAddr == nullptr)
-			{
-				return false;
-			}
+			ObjectChain = &Chain->ObjectChains[Chain->NextObjectChain];
+			Chain->NextObjectChain = (Chain->NextObjectChain + 1) % MaxObjectChains;
+		}
+		ObjectChain->Target = Target;
+	}
+	BuildObjectHops(*Chain, Target, &ObjectChain->Hops);
 
-			FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(ValueProperty);
-			UObject* Object = ObjectProperty->GetPropertyValue(ValueAddr);
+	return Terminal;
+}
 
-			return HandleTerminalProperty(VarDescs, VarDepth + 1, Object, Dest, DestAddr, NewValue, NewValueAddr, Params);
+TTuple<FProperty*, void*> ResolveTerminalProperty(
+	FVarAccessChain* Chain, UObject* OuterObject, FProperty* ExpectedProperty, const FAccessVariableParams& Params)
+{
+	if (Chain->NativeBinding != nullptr)
+	{
+		TTuple<FProperty*, void*> Terminal =
+			FVariableAccessNativeAccessors::Resolve(*Chain->NativeBinding, OuterObject, ExpectedProperty);
+		if (Terminal.Get<0>() != nullptr)
+		{
+			return Terminal;
 		}
+	}
 
-		return false;
+	if (Params.bCacheObjectChain && OuterObject != nullptr && Chain->Links.Num() == Chain->VarDescs.Num())
+	{
+		return ResolveTerminalPropertyWithObjectChain(Chain, OuterObject, ExpectedProperty, Params);
 	}
 
-	return false;
+	return ResolveTerminalProperty(Chain->VarDescs, 0, OuterObject, ExpectedProperty, Params, Chain->Links.GetData());
 }
 
-bool HandleTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, FStructProperty* OuterProperty,
-	void* OuterAddr, FProperty* Dest, void* DestAddr, FProperty* NewValue, void* NewValueAddr, const FAccessVariableParams& Params)
+bool HandleTerminalProperty(FVarAccessChain* Chain, UObject* OuterObject, FProperty* Dest, void* DestAddr, FProperty* NewValue,
+	void* NewValueAddr, const FAccessVariableParams& Params)
 {
-	if (VarDescs.Num() <= VarDepth)
+	if (Dest == nullptr || DestAddr == nullptr)
 	{
 		return false;
 	}
 
-	const FVarDescription& Desc = VarDescs[VarDepth];
+	if (Chain->NativeBinding != nullptr &&
+		FVariableAccessNativeAccessors::Copy(*Chain->NativeBinding, OuterObject, Dest, DestAddr, NewValue, NewValueAddr))
+	{
+		return true;
+	}
 
-	if (!Desc.bIsValid)
+	TTuple<FProperty*, void*> Terminal = ResolveTerminalProperty(Chain, OuterObject, Dest, Params);
+
+	return CopyTerminalProperty(Terminal, DestAddr, NewValue, NewValueAddr);
+}
+
+// Parsed variable names are kept up to this number, so that generated names can not grow the cache unboundedly.
+const int32 MaxParsedVarNames = 4096;
+
+using FParseCache = VarAccessPath::TParseCache<TCHAR, TArray<FVarDescription>>;
+using FParsedVarNamePtr = FParseCache::FEntryPtr;
+
+FParseCache ParseCache(MaxParsedVarNames);
+
+uint32 GetVarNameHash(FStringView VarName)
+{
+	return VarAccessPath::HashPath(VarName.GetData(), VarName.Len());
+}
+
+bool EqualsVarName(const FString& A, FStringView B)
+{
+	return A.Len() == B.Len() && FCString::Strncmp(*A, B.GetData(), B.Len()) == 0;
+}
+
+FVarDescription MakeVarDescription(const VarAccessPath::TSegmentView<TCHAR>& Segment)
+{
+	FVarDescription Desc;
+	Desc.bIsValid = Segment.bIsValid;
+	Desc.ArrayAccessType = EArrayAccessType::ArrayAccessType_None;
+	if (!Segment.bIsValid)
 	{
-		return false;
+		return Desc;
 	}
 
-	UScriptStruct* ScriptStruct = OuterProperty->Struct;
-	FProperty* Property = GetScriptStructProperty(ScriptStruct, Desc.VarName);
-	if (Property == nullptr)
+	Desc.VarName = FString(FStringView(Segment.Name, static_cast<int32>(Segment.NameLength)));
+	Desc.Name = FName(*Desc.VarName);
+	switch (Segment.IndexType)
 	{
-		return false;
+		case VarAccessPath::EIndexType::Integer:
+			Desc.ArrayAccessType = EArrayAccessType::ArrayAccessType_Integer;
+			Desc.ArrayAccessValue.Integer = Segment.Integer;
+			break;
+		case VarAccessPath::EIndexType::String:
+			Desc.ArrayAccessType = EArrayAccessType::ArrayAccessType_String;
+			Desc.ArrayAccessValue.String = FString(FStringView(Segment.String, static_cast<int32>(Segment.StringLength)));
+			break;
+		default:
+			break;
 	}
+	Desc.ArgumentIndex = Segment.ArgumentIndex;
 
-	return HandleTerminalPropertyInternal(VarDescs, VarDepth, Property, OuterAddr, Dest, DestAddr, NewValue, NewValueAddr, Params);
+	return Desc;
 }
 
-bool HandleTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth, UObject* OuterObject, FProperty* Dest,
-	void* DestAddr, FProperty* NewValue, void* NewValueAddr, const FAccessVariableParams& Params)
+void BuildVarDescs(const TCHAR* VarName, size_t Length, TArray<FVarDescription>& OutVarDescs)
 {
-	if (VarDescs.Num() <= VarDepth)
+	for (VarAccessPath::FToken Token = VarAccessPath::NextToken(VarName, Length, 0); Token.Length > 0;
+		 Token = VarAccessPath::NextToken(VarName, Length, Token.Offset + Token.Length + 1))
 	{
-		return false;
+		OutVarDescs.Add(MakeVarDescription(VarAccessPath::ScanSegment(VarName + Token.Offset, Token.Length)));
 	}
+}
 
-	const FVarDescription& Desc = VarDescs[VarDepth];
+const FParsedVarNamePtr& FindOrParseVarName(FStringView VarName, uint32 Hash)
+{
+	return ParseCache.FindOrAdd(VarName.GetData(), VarName.Len(), Hash, BuildVarDescs);
+}
 
-	if (!Desc.bIsValid)
+void ParseVarNameInternal(FStringView VarName, TArray<FVarDescription>* VarDescs)
+{
+	*VarDescs = FindOrParseVarName(VarName, GetVarNameHash(VarName))->Value;
+}
+
+FVarAccessCacheStats GetParseCacheStats()
+{
+	const VarAccessPath::FCacheStats CoreStats = ParseCache.GetStats();
+	FVarAccessCacheStats Stats;
+
+	Stats.L1Hits = CoreStats.L1Hits;
+	Stats.SharedHits = CoreStats.SharedHits;
+	Stats.Misses = CoreStats.Misses;
+	Stats.ContendedLocks = CoreStats.ContendedLocks;
+
+	return Stats;
+}
+
+void ResetParseCacheStats()
+{
+	ParseCache.ResetStats();
+}
+
+bool ParseVarName(const FString& VarName, TArray<FVarDescription>* VarDescs)
+{
+	return ParseVarName(FStringView(VarName), VarDescs);
+}
+
+bool IsSupportedVarDescs(const TArray<FVarDescription>& VarDescs)
+{
+#ifdef AVBN_FREE_VERSION
+	if (VarDescs.Num() >= 2)
 	{
+		UE_LOG(LogTemp, Error,
+			TEXT("Nested property is not supported on the free version. Please consider to buy full version at Fab."));
 		return false;
 	}
-
-	if (OuterObject == nullptr)
+	if (VarDescs.Num() == 1 && VarDescs[0].ArrayAccessType != ArrayAccessType_None)
 	{
+		UE_LOG(LogTemp, Error,
+			TEXT("The access of Array/Map's element is not supported on the free version. "
+				 "Please consider to buy full version at Fab."));
 		return false;
 	}
+#endif
 
-	TTuple<FProperty*, UObject*> Result = GetObjectProperty(OuterObject, Desc.VarName, Params.bIncludeGenerationClass);
-	if (Result.Get<0>() == nullptr || Result.Get<1>() == nullptr)
+	return true;
+}
+
+bool ParseVarName(FStringView VarName, TArray<FVarDescription>* VarDescs)
+{
+	ParseVarNameInternal(VarName, VarDescs);
+
+	return IsSupportedVarDescs(*VarDescs);
+}
+
+// Looked up only when the chain is created, so that the generated accessors cost nothing on the cached accesses.
+const FVarAccessNativeBinding* FindNativeBinding(const UClass* TargetClass, FStringView VarName)
+{
+	if (!FVariableAccessNativeAccessors::HasAccessors() || VarName.Len() >= NAME_SIZE)
 	{
-		return false;
+		return nullptr;
+	}
+
+	// The registered paths are added to the name table on the registration, so that a string path is never added here.
+	const FName Name(VarName.Len(), VarName.GetData(), FNAME_Find);
+	if (Name.IsNone())
+	{
+		return nullptr;
 	}
 
-	return HandleTerminalPropertyInternal(
-		VarDescs, VarDepth, Result.Get<0>(), Result.Get<1>(), Dest, DestAddr, NewValue, NewValueAddr, Params);
+	return FVariableAccessNativeAccessors::Find(TargetClass, Name);
 }
 
-void SplitVarNameInternal(const FString& In, int32 StartIndex, TArray<FString>* Out)
+// Chains of the accesses without a call site are remembered per thread, so that a repeated access does not allocate.
+const int32 NumThreadChainSlots = 32;
+
+struct FThreadChainEntry
 {
-	bool bInString = false;
-	int32 Index = StartIndex;
-	for (; Index < In.Len(); ++Index)
+	// The class may be destroyed and its address reused after the epoch changes.
+	uint32 Epoch = 0;
+	const UClass* TargetClass = nullptr;
+	bool bIncludeGenerationClass = false;
+	FParsedVarNamePtr Parsed;
+	FVarAccessChain Chain;
+};
+
+struct FThreadChainCache
+{
+	FThreadChainEntry Entries[NumThreadChainSlots];
+};
+
+thread_local FThreadChainCache ThreadChainCache;
+
+FVarAccessChain* FindThreadChain(UObject* Target, FStringView VarName, const FAccessVariableParams& Params)
+{
+	const uint32 Hash = GetVarNameHash(VarName);
+	const UClass* TargetClass = Target != nullptr ? Target->GetClass() : nullptr;
+	const uint32 Epoch = GetCacheEpoch();
+
+	FThreadChainEntry& Entry = ThreadChainCache.Entries[HashCombine(Hash, GetTypeHash(TargetClass)) % NumThreadChainSlots];
+	if (Entry.Epoch == Epoch && Entry.TargetClass == TargetClass &&
+		Entry.bIncludeGenerationClass == Params.bIncludeGenerationClass && Entry.Parsed &&
+		Entry.Parsed->Matches(Hash, VarName.GetData(), VarName.Len()))
+	{
+		return &Entry.Chain;
+	}
+
+	const FParsedVarNamePtr& Parsed = FindOrParseVarName(VarName, Hash);
+	if (!IsSupportedVarDescs(Parsed->Value))
 	{
-		FString Ch = In.Mid(Index, 1);
-		if (Ch == "\"")
+		return nullptr;
+	}
+
+	Entry.Epoch = Epoch;
+	Entry.TargetClass = TargetClass;
+	Entry.bIncludeGenerationClass = Params.bIncludeGenerationClass;
+	Entry.Parsed = Parsed;
+	Entry.Chain.VarDescs = Parsed->Value;
+	Entry.Chain.Links.Reset();
+	Entry.Chain.Links.SetNum(Parsed->Value.Num());
+	Entry.Chain.ObjectChains.Reset();
+	Entry.Chain.NextObjectChain = 0;
+	Entry.Chain.NativeBinding = FindNativeBinding(TargetClass, VarName);
+
+	return &Entry.Chain;
+}
+
+// Call sites which see more pairs of the class and the variable name than this use the uncached path.
+const int32 MaxCallSiteEntries = 4;
+
+struct FVarAccessCallSiteEntry
+{
+	TWeakObjectPtr<UClass> TargetClass;
+	FName VarName;
+	FString VarString;
+	bool bStringVarName = false;
+	bool bIncludeGenerationClass = false;
+	FVarAccessChain Chain;
+};
+
+struct FVarAccessCallSite
+{
+	TArray<FVarAccessCallSiteEntry, TInlineAllocator<MaxCallSiteEntries>> Entries;
+	bool bMegamorphic = false;
+};
+
+TMap<FVarAccessCallSiteKey, FVarAccessCallSite> CallSites;
+uint32 CallSitesEpoch = 0;
+
+FVarAccessCallSiteKey MakeCallSiteKey(const FFrame& Stack)
+{
+	FVarAccessCallSiteKey Key;
+
+	// Native functions run on the frame of the caller, so the code pointer is at the parameters of this call.
+	if (Stack.Node == nullptr || Stack.Code == nullptr)
+	{
+		return Key;
+	}
+	const TArray<uint8>& Script = Stack.Node->Script;
+	const int64 CodeOffset = Stack.Code - Script.GetData();
+	if (CodeOffset < 0 || CodeOffset >= Script.Num())
+	{
+		return Key;
+	}
+
+	Key.Function = Stack.Node;
+	Key.CodeOffset = (int32) CodeOffset;
+
+	return Key;
+}
+
+FVarAccessChain* FindCallSiteChainInternal(const FVarAccessCallSiteKey& CallSite, UObject* Target, FName VarName,
+	const FStringView* VarString, const FAccessVariableParams& Params)
+{
+#ifdef AVBN_FREE_VERSION
+	// The unsupported syntax is reported by the uncached path.
+	return nullptr;
+#else
+	if (!CallSite.IsValid() || Target == nullptr || !IsInGameThread())
+	{
+		return nullptr;
+	}
+
+	const uint32 Epoch = GetCacheEpoch();
+	if (CallSitesEpoch != Epoch)
+	{
+		CallSites.Reset();
+		CallSitesEpoch = Epoch;
+	}
+
+	FVarAccessCallSite& Site = CallSites.FindOrAdd(CallSite);
+	if (Site.bMegamorphic)
+	{
+		return nullptr;
+	}
+
+	UClass* TargetClass = Target->GetClass();
+	const bool bStringVarName = VarString != nullptr;
+	for (FVarAccessCallSiteEntry& Entry : Site.Entries)
+	{
+		if (Entry.TargetClass.Get() != TargetClass || Entry.bStringVarName != bStringVarName ||
+			Entry.bIncludeGenerationClass != Params.bIncludeGenerationClass)
 		{
-			bInString = !bInString;
+			continue;
 		}
-
-		if (!bInString && Ch == ".")
+		if (bStringVarName ? EqualsVarName(Entry.VarString, *VarString) : Entry.VarName == VarName)
 		{
-			Out->Add(In.Mid(StartIndex, Index - StartIndex));
-			SplitVarNameInternal(In, Index + 1, Out);
-			break;
+			return &Entry.Chain;
 		}
 	}
-	if (Index == In.Len())
+
+	Site.Entries.RemoveAll([](const FVarAccessCallSiteEntry& Entry) { return !Entry.TargetClass.IsValid(); });
+	if (Site.Entries.Num() >= MaxCallSiteEntries)
 	{
-		Out->Add(In.Mid(StartIndex, Index - StartIndex));
+		Site.bMegamorphic = true;
+		Site.Entries.Empty();
+		return nullptr;
 	}
+
+	FVarAccessCallSiteEntry& NewEntry = Site.Entries.AddDefaulted_GetRef();
+	NewEntry.TargetClass = TargetClass;
+	NewEntry.bStringVarName = bStringVarName;
+	NewEntry.bIncludeGenerationClass = Params.bIncludeGenerationClass;
+	if (bStringVarName)
+	{
+		NewEntry.VarString = FString(*VarString);
+		ParseVarName(*VarString, &NewEntry.Chain.VarDescs);
+		NewEntry.Chain.NativeBinding = FindNativeBinding(TargetClass, *VarString);
+	}
+	else
+	{
+		NewEntry.VarName = VarName;
+		ParseVarName(VarName.ToString(), &NewEntry.Chain.VarDescs);
+		NewEntry.Chain.NativeBinding = FVariableAccessNativeAccessors::Find(TargetClass, VarName);
+	}
+	NewEntry.Chain.Links.SetNum(NewEntry.Chain.VarDescs.Num());
+
+	return &NewEntry.Chain;
+#endif
 }
 
-void SplitVarName(const FString& In, TArray<FString>* Out)
+FVarAccessChain* FindCallSiteChain(
+	const FVarAccessCallSiteKey& CallSite, UObject* Target, FName VarName, const FAccessVariableParams& Params)
 {
-	SplitVarNameInternal(In, 0, Out);
-	*Out = Out->FilterByPredicate([](const FString& S) { return !S.IsEmpty(); });
+	return FindCallSiteChainInternal(CallSite, Target, VarName, nullptr, Params);
 }
 
-void AnalyzeVarNames(const TArray<FString>& VarNames, TArray<FVarDescription>* VarDescs)
+FVarAccessChain* FindCallSiteChain(
+	const FVarAccessCallSiteKey& CallSite, UObject* Target, FStringView VarName, const FAccessVariableParams& Params)
 {
-	for (auto& Var : VarNames)
+	return FindCallSiteChainInternal(CallSite, Target, NAME_None, &VarName, Params);
+}
+
+void InvalidateCaches()
+{
+	++CacheEpoch;
+	FVariableAccessThreadSafe::ResetCache();
+}
+
+uint32 GetCacheEpoch()
+{
+	return CacheEpoch.load();
+}
+
+FVarAccessContainerView MakeContainerView(UObject* Target, FName VarName, const FAccessVariableParams& Params,
+	FProperty* ContainerProperty, void* ContainerAddr)
+{
+	FVarAccessContainerView View;
+	View.Target = Target;
+	View.VarName = VarName;
+	View.Params = Params;
+	View.Property = ContainerProperty;
+	View.Epoch = GetCacheEpoch();
+
+	// The container reached through structure members of the target stays at the same offset while the target lives.
+	const uint8* TargetAddr = reinterpret_cast<const uint8*>(Target);
+	const uint8* Addr = static_cast<const uint8*>(ContainerAddr);
+	if (Addr >= TargetAddr && Addr < TargetAddr + Target->GetClass()->GetPropertiesSize())
+	{
+		View.Offset = (int32) (Addr - TargetAddr);
+	}
+
+	return View;
+}
+
+void* ResolveContainerView(const FVarAccessContainerView& View)
+{
+	UObject* Target = View.Target.Get();
+	if (Target == nullptr || View.Property == nullptr || View.Epoch != GetCacheEpoch())
+	{
+		return nullptr;
+	}
+	if (View.Offset != INDEX_NONE)
+	{
+		return reinterpret_cast<uint8*>(Target) + View.Offset;
+	}
+
+	// The container lives in another object or in an element of another container, which may be moved by the loop body.
+	FNameBuilder VarNameBuilder(View.VarName);
+	FVarAccessChain* Chain = FindThreadChain(Target, VarNameBuilder.ToView(), View.Params);
+	if (Chain == nullptr)
+	{
+		return nullptr;
+	}
+	TTuple<FProperty*, void*> Terminal = ResolveTerminalProperty(Chain, Target, nullptr, View.Params);
+	if (Terminal.Get<0>() != View.Property)
 	{
-		// String pattern.
+		return nullptr;
+	}
+
+	return Terminal.Get<1>();
+}
+
+bool ApplyArguments(TArray<FVarDescription>* VarDescs, const FVarAccessArguments& Arguments)
+{
+	for (FVarDescription& Desc : *VarDescs)
+	{
+		if (Desc.ArgumentIndex == INDEX_NONE)
 		{
-			FRegexPattern Pattern = FRegexPattern("^([a-zA-Z_][a-zA-Z0-9_ ]*)\\[\"(\\S+)\"\\]$");
-			FRegexMatcher Matcher(Pattern, Var);
-			if (Matcher.FindNext())
-			{
-				FVarDescription Desc;
-				Desc.bIsValid = true;
-				Desc.VarName = Matcher.GetCaptureGroup(1);
-				Desc.ArrayAccessType = EArrayAccessType::ArrayAccessType_String;
-				Desc.ArrayAccessValue.Integer = -1;
-				Desc.ArrayAccessValue.String = Matcher.GetCaptureGroup(2);
-				VarDescs->Add(Desc);
-				continue;
-			}
+			continue;
 		}
 
-		// Integer pattern.
+		if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_Integer)
 		{
-			FRegexPattern Pattern = FRegexPattern("^([a-zA-Z_][a-zA-Z0-9_ ]*)\\[([0-9]+)\\]$");
-			FRegexMatcher Matcher(Pattern, Var);
-			if (Matcher.FindNext())
+			if (!Arguments.Integers.IsValidIndex(Desc.ArgumentIndex))
 			{
-				FVarDescription Desc;
-				Desc.bIsValid = true;
-				Desc.VarName = Matcher.GetCaptureGroup(1);
-				Desc.ArrayAccessType = EArrayAccessType::ArrayAccessType_Integer;
-				Desc.ArrayAccessValue.Integer = FCString::Atoi(*Matcher.GetCaptureGroup(2));
-				Desc.ArrayAccessValue.String = "";
-				VarDescs->Add(Desc);
-				continue;
+				return false;
 			}
+			Desc.ArrayAccessValue.Integer = Arguments.Integers[Desc.ArgumentIndex];
 		}
-
-		// None pattern.
+		else if (Desc.ArrayAccessType == EArrayAccessType::ArrayAccessType_String)
 		{
-			FRegexPattern Pattern = FRegexPattern("^([a-zA-Z_][a-zA-Z0-9_ ]*)$");
-			FRegexMatcher Matcher(Pattern, Var);
-			if (Matcher.FindNext())
+			if (!Arguments.Names.IsValidIndex(Desc.ArgumentIndex))
 			{
-				FVarDescription Desc;
-				Desc.bIsValid = true;
-				Desc.VarName = Matcher.GetCaptureGroup(1);
-				Desc.ArrayAccessType = EArrayAccessType::ArrayAccessType_None;
-				Desc.ArrayAccessValue.Integer = -1;
-				Desc.ArrayAccessValue.String = "";
-				VarDescs->Add(Desc);
-				continue;
+				return false;
 			}
+			Desc.ArrayAccessValue.String = Arguments.Names[Desc.ArgumentIndex].ToString();
 		}
+	}
+
+	return true;
+}
 
-		FVarDescription Desc;
-		Desc.bIsValid = false;
-		VarDescs->Add(Desc);
+void SplitVarName(const FString& In, TArray<FString>* Out)
+{
+	std::vector<VarAccessPath::FToken> Tokens;
+	VarAccessPath::Tokenize(*In, In.Len(), &Tokens);
+
+	for (const VarAccessPath::FToken& Token : Tokens)
+	{
+		Out->Add(In.Mid(static_cast<int32>(Token.Offset), static_cast<int32>(Token.Length)));
+	}
+}
+
+void AnalyzeVarNames(const TArray<FString>& VarNames, TArray<FVarDescription>* VarDescs)
+{
+	for (auto& Var : VarNames)
+	{
+		VarDescs->Add(MakeVarDescription(VarAccessPath::ScanSegment(*Var, Var.Len())));
 	}
 }
 }	 // namespace FVariableAccessFunctionLibraryUtils
\ No newline at end of file
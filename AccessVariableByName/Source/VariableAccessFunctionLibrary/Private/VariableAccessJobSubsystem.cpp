@@ -0,0 +1,347 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableAccessJobSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "UObject/UnrealType.h"
+
+// Get jobs with fewer values than this copy them on the game thread even if parallel copy is requested.
+const int32 MinParallelReads = 256;
+
+void FVarAccessJobTickFunction::ExecuteTick(
+	float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem != nullptr)
+	{
+		Subsystem->ExecuteJobs(TickGroup);
+	}
+}
+
+FString FVarAccessJobTickFunction::DiagnosticMessage()
+{
+	return TEXT("FVarAccessJobTickFunction");
+}
+
+void UVariableAccessJobSubsystem::Deinitialize()
+{
+	for (TUniquePtr<FVarAccessJobTickFunction>& TickFunction : TickFunctions)
+	{
+		if (TickFunction->IsTickFunctionRegistered())
+		{
+			TickFunction->UnRegisterTickFunction();
+		}
+	}
+	TickFunctions.Empty();
+	Jobs.Empty();
+	PendingJobs.Empty();
+	PendingRemovals.Empty();
+	PendingTargets.Empty();
+	Chains.Empty();
+	Snapshots.Empty();
+
+	Super::Deinitialize();
+}
+
+FVarAccessJobHandle UVariableAccessJobSubsystem::RegisterJob(const FVarAccessJob& Job)
+{
+	check(IsInGameThread());
+
+	FVarAccessJobHandle Handle;
+
+	if (Job.ValueProperty == nullptr)
+	{
+		return Handle;
+	}
+	if (Job.Mode == EVarAccessJobMode::Set && Job.Buffer == nullptr)
+	{
+		return Handle;
+	}
+
+	TArray<FVarDescription> VarDescs;
+	if (!FVariableAccessFunctionLibraryUtils::ParseVarName(Job.VarName, &VarDescs))
+	{
+		return Handle;
+	}
+
+	Handle.Id = NextJobId++;
+	FJobEntry& Entry = bExecutingJobs ? PendingJobs.Add(Handle.Id) : Jobs.Add(Handle.Id);
+	Entry.Job = Job;
+	Entry.VarDescs = MoveTemp(VarDescs);
+	SortTargets(&Entry);
+
+	EnsureTickFunction(Job.TickGroup);
+
+	return Handle;
+}
+
+void UVariableAccessJobSubsystem::UnregisterJob(FVarAccessJobHandle Handle)
+{
+	check(IsInGameThread());
+
+	if (bExecutingJobs)
+	{
+		if (PendingJobs.Remove(Handle.Id) == 0 && Jobs.Contains(Handle.Id))
+		{
+			PendingRemovals.Add(Handle.Id);
+			PendingTargets.Remove(Handle.Id);
+		}
+		return;
+	}
+
+	Jobs.Remove(Handle.Id);
+}
+
+void UVariableAccessJobSubsystem::SetJobTargets(
+	FVarAccessJobHandle Handle, const TArray<TWeakObjectPtr<UObject>>& Targets, void* Buffer, bool* Succeeded)
+{
+	check(IsInGameThread());
+
+	FJobEntry* Entry = bExecutingJobs ? PendingJobs.Find(Handle.Id) : Jobs.Find(Handle.Id);
+	if (Entry == nullptr)
+	{
+		if (bExecutingJobs && Jobs.Contains(Handle.Id) && !PendingRemovals.Contains(Handle.Id))
+		{
+			FPendingTargets& Pending = PendingTargets.Add(Handle.Id);
+			Pending.Targets = Targets;
+			Pending.Buffer = Buffer;
+			Pending.Succeeded = Succeeded;
+		}
+		return;
+	}
+
+	Entry->Job.Targets = Targets;
+	Entry->Job.Buffer = Buffer;
+	Entry->Job.Succeeded = Succeeded;
+	SortTargets(Entry);
+}
+
+void UVariableAccessJobSubsystem::AddSnapshot(
+	const TSharedRef<FVarAccessSnapshot, ESPMode::ThreadSafe>& Snapshot, ETickingGroup TickGroup)
+{
+	check(IsInGameThread());
+
+	FSnapshotEntry& Entry = Snapshots.AddDefaulted_GetRef();
+	Entry.Snapshot = Snapshot;
+	Entry.TickGroup = TickGroup;
+
+	EnsureTickFunction(TickGroup);
+}
+
+void UVariableAccessJobSubsystem::RemoveSnapshot(const TSharedRef<FVarAccessSnapshot, ESPMode::ThreadSafe>& Snapshot)
+{
+	check(IsInGameThread());
+
+	Snapshots.RemoveAll([&Snapshot](const FSnapshotEntry& Entry) { return Entry.Snapshot == Snapshot; });
+}
+
+void UVariableAccessJobSubsystem::SortTargets(FJobEntry* Entry)
+{
+	const TArray<TWeakObjectPtr<UObject>>& Targets = Entry->Job.Targets;
+
+	TArray<const UClass*> Classes;
+	Classes.SetNum(Targets.Num());
+	for (int32 Index = 0; Index < Targets.Num(); ++Index)
+	{
+		const UObject* Target = Targets[Index].Get();
+		Classes[Index] = Target != nullptr ? Target->GetClass() : nullptr;
+	}
+
+	Entry->Order.SetNum(Targets.Num());
+	for (int32 Index = 0; Index < Targets.Num(); ++Index)
+	{
+		Entry->Order[Index] = Index;
+	}
+	Entry->Order.Sort([&Classes](int32 A, int32 B) { return Classes[A] < Classes[B]; });
+}
+
+FVarAccessChain* UVariableAccessJobSubsystem::FindChain(const UClass* Class, const FJobEntry& Entry)
+{
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+	if (ChainsEpoch != Epoch)
+	{
+		Chains.Reset();
+		ChainsEpoch = Epoch;
+	}
+
+	FChainKey Key;
+	Key.Class = Class;
+	Key.VarName = Entry.Job.VarName;
+	Key.bIncludeGenerationClass = Entry.Job.Params.bIncludeGenerationClass;
+
+	FVarAccessChain* Chain = Chains.Find(Key);
+	if (Chain == nullptr)
+	{
+		Chain = &Chains.Add(Key);
+		Chain->VarDescs = Entry.VarDescs;
+		Chain->Links.SetNum(Entry.VarDescs.Num());
+	}
+
+	return Chain;
+}
+
+void UVariableAccessJobSubsystem::ExecuteJobs(ETickingGroup TickGroup)
+{
+	check(!bExecutingJobs);
+
+	bExecutingJobs = true;
+	for (TPair<int32, FJobEntry>& Pair : Jobs)
+	{
+		// The job unregistered by a callback of the previous job is not executed any more.
+		if (Pair.Value.Job.TickGroup == TickGroup && !PendingRemovals.Contains(Pair.Key))
+		{
+			ExecuteJob(&Pair.Value);
+		}
+	}
+	bExecutingJobs = false;
+	ApplyPendingChanges();
+
+	for (const FSnapshotEntry& Entry : Snapshots)
+	{
+		if (Entry.TickGroup == TickGroup)
+		{
+			Entry.Snapshot->Capture();
+		}
+	}
+}
+
+void UVariableAccessJobSubsystem::ExecuteJob(FJobEntry* Entry)
+{
+	const FVarAccessJob& Job = Entry->Job;
+	const int32 ValueSize = Job.ValueProperty->GetSize();
+	uint8* Buffer = static_cast<uint8*>(Job.Buffer);
+
+	// Resolve on the game thread, since the chains are shared among the jobs.
+	Entry->Reads.Reset();
+	const UClass* LastClass = nullptr;
+	FVarAccessChain* Chain = nullptr;
+	for (int32 Index : Entry->Order)
+	{
+		UObject* Target = Job.Targets[Index].Get();
+		bool bSuccess = false;
+		if (Target != nullptr)
+		{
+			if (Chain == nullptr || Target->GetClass() != LastClass)
+			{
+				LastClass = Target->GetClass();
+				Chain = FindChain(LastClass, *Entry);
+			}
+
+			TTuple<FProperty*, void*> Terminal =
+				FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(Chain, Target, Job.ValueProperty, Job.Params);
+			FProperty* TerminalProperty = Terminal.Get<0>();
+			void* TerminalAddr = Terminal.Get<1>();
+			if (TerminalProperty != nullptr && TerminalAddr != nullptr)
+			{
+				if (Job.Mode == EVarAccessJobMode::Set)
+				{
+					TerminalProperty->CopyCompleteValue(TerminalAddr, Buffer + Index * ValueSize);
+				}
+				else
+				{
+					Entry->Reads.Add(TTuple<int32, void*>(Index, TerminalAddr));
+				}
+				bSuccess = true;
+			}
+		}
+		if (Job.Succeeded != nullptr)
+		{
+			Job.Succeeded[Index] = bSuccess;
+		}
+	}
+
+	if (Job.Mode != EVarAccessJobMode::Get)
+	{
+		return;
+	}
+
+	const TArray<TTuple<int32, void*>>& Reads = Entry->Reads;
+	if (Buffer != nullptr)
+	{
+		FProperty* ValueProperty = Job.ValueProperty;
+		auto CopyValue = [&Reads, ValueProperty, Buffer, ValueSize](int32 ReadIndex)
+		{
+			const TTuple<int32, void*>& Read = Reads[ReadIndex];
+			ValueProperty->CopyCompleteValue(Buffer + Read.Get<0>() * ValueSize, Read.Get<1>());
+		};
+		if (Job.bParallel && Reads.Num() >= MinParallelReads)
+		{
+			ParallelFor(Reads.Num(), CopyValue);
+		}
+		else
+		{
+			for (int32 ReadIndex = 0; ReadIndex < Reads.Num(); ++ReadIndex)
+			{
+				CopyValue(ReadIndex);
+			}
+		}
+	}
+
+	if (Job.Callback)
+	{
+		for (const TTuple<int32, void*>& Read : Reads)
+		{
+			const int32 Index = Read.Get<0>();
+			Job.Callback(Index, Job.Targets[Index].Get(), Job.ValueProperty, Read.Get<1>());
+		}
+	}
+}
+
+void UVariableAccessJobSubsystem::ApplyPendingChanges()
+{
+	for (int32 Id : PendingRemovals)
+	{
+		Jobs.Remove(Id);
+	}
+	PendingRemovals.Reset();
+
+	for (TPair<int32, FPendingTargets>& Pair : PendingTargets)
+	{
+		FJobEntry* Entry = Jobs.Find(Pair.Key);
+		if (Entry != nullptr)
+		{
+			Entry->Job.Targets = MoveTemp(Pair.Value.Targets);
+			Entry->Job.Buffer = Pair.Value.Buffer;
+			Entry->Job.Succeeded = Pair.Value.Succeeded;
+			SortTargets(Entry);
+		}
+	}
+	PendingTargets.Reset();
+
+	for (TPair<int32, FJobEntry>& Pair : PendingJobs)
+	{
+		Jobs.Add(Pair.Key, MoveTemp(Pair.Value));
+	}
+	PendingJobs.Reset();
+}
+
+void UVariableAccessJobSubsystem::EnsureTickFunction(ETickingGroup TickGroup)
+{
+	for (const TUniquePtr<FVarAccessJobTickFunction>& TickFunction : TickFunctions)
+	{
+		if (TickFunction->TickGroup == TickGroup)
+		{
+			return;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (World == nullptr || World->PersistentLevel == nullptr)
+	{
+		return;
+	}
+
+	TUniquePtr<FVarAccessJobTickFunction>& TickFunction = TickFunctions.Add_GetRef(MakeUnique<FVarAccessJobTickFunction>());
+	TickFunction->Subsystem = this;
+	TickFunction->bCanEverTick = true;
+	TickFunction->TickGroup = TickGroup;
+	TickFunction->RegisterTickFunction(World->PersistentLevel);
+}
@@ -0,0 +1,218 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableAccessNativeAccessors.h"
+
+#include "Misc/ScopeLock.h"
+#include "UObject/UnrealType.h"
+
+namespace FVariableAccessNativeAccessors
+{
+using FBindingKey = TPair<const UClass*, FName>;
+
+// Accessor registered on the static initialization, before the classes can be resolved.
+struct FPendingAccessor
+{
+	const FVarAccessNativeAccessor* Accessor = nullptr;
+	// Added to the name table on the registration, so that the lookup of a path finds the name without adding one.
+	FName VarName;
+};
+
+struct FRegistry
+{
+	FCriticalSection Lock;
+	TArray<FPendingAccessor> PendingAccessors;
+	TMap<FBindingKey, TUniquePtr<FVarAccessNativeBinding>> Bindings;
+	std::atomic<int32> NumAccessors{0};
+};
+
+FRegistry& GetRegistry()
+{
+	// Constructed on the first registration, which may run before the static variables of this module are initialized.
+	static FRegistry Registry;
+	return Registry;
+}
+
+void Register(TArrayView<const FVarAccessNativeAccessor> Accessors)
+{
+	FRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+
+	for (const FVarAccessNativeAccessor& Accessor : Accessors)
+	{
+		FPendingAccessor& Pending = Registry.PendingAccessors.AddDefaulted_GetRef();
+		Pending.Accessor = &Accessor;
+		Pending.VarName = FName(Accessor.VarName);
+	}
+	Registry.NumAccessors += Accessors.Num();
+}
+
+void Unregister(TArrayView<const FVarAccessNativeAccessor> Accessors)
+{
+	FRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+
+	for (const FVarAccessNativeAccessor& Accessor : Accessors)
+	{
+		Registry.PendingAccessors.RemoveAll([&Accessor](const FPendingAccessor& Pending) { return Pending.Accessor == &Accessor; });
+
+		// The code of the accessor may be unloaded, while the chains still refer to the binding.
+		for (TPair<FBindingKey, TUniquePtr<FVarAccessNativeBinding>>& Pair : Registry.Bindings)
+		{
+			FVarAccessNativeBinding& Binding = *Pair.Value;
+			if (Binding.RegisteredAccessor == &Accessor)
+			{
+				Binding.Accessor.store(nullptr);
+				Binding.RegisteredAccessor = nullptr;
+			}
+		}
+	}
+	Registry.NumAccessors -= Accessors.Num();
+}
+
+bool HasAccessors()
+{
+	return GetRegistry().NumAccessors.load() > 0;
+}
+
+void BindPendingAccessors(FRegistry& Registry)
+{
+	for (const FPendingAccessor& Pending : Registry.PendingAccessors)
+	{
+		const UClass* Class = Pending.Accessor->GetClass();
+		TUniquePtr<FVarAccessNativeBinding>& Binding = Registry.Bindings.FindOrAdd(FBindingKey(Class, Pending.VarName));
+		if (!Binding.IsValid())
+		{
+			Binding = MakeUnique<FVarAccessNativeBinding>();
+			Binding->Class = Class;
+		}
+
+		// The reloaded module registers its accessors again.
+		Binding->Accessor.store(nullptr);
+		Binding->RegisteredAccessor = Pending.Accessor;
+		Binding->bVerified = false;
+	}
+	Registry.PendingAccessors.Reset();
+}
+
+// Return false if the default object is not created yet, so that the binding is verified on the next lookup.
+bool VerifyBinding(FVarAccessNativeBinding* Binding)
+{
+	UObject* DefaultObject = Binding->Class->GetDefaultObject(false);
+	if (DefaultObject == nullptr)
+	{
+		return false;
+	}
+	Binding->bVerified = true;
+
+	const FVarAccessNativeAccessor* Accessor = Binding->RegisteredAccessor;
+	TArray<FVarDescription> VarDescs;
+	TTuple<FProperty*, void*> Terminal(nullptr, nullptr);
+	FAccessVariableParams Params;
+	if (FVariableAccessFunctionLibraryUtils::ParseVarName(FString(Accessor->VarName), &VarDescs))
+	{
+		Terminal = FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(VarDescs, 0, DefaultObject, nullptr, Params);
+	}
+
+	// The generated source is stale if the member is moved or its type is changed.
+	if (Terminal.Get<0>() == nullptr || Terminal.Get<1>() != Accessor->GetAddress(DefaultObject))
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("The native accessor of '%s' on %s does not match the reflection data, so it is not used. "
+				 "Please generate the native accessors again."),
+			Accessor->VarName, *Binding->Class->GetName());
+		return false;
+	}
+
+	Binding->Property = Terminal.Get<0>();
+	Binding->Accessor.store(Accessor);
+
+	return true;
+}
+
+const FVarAccessNativeBinding* Find(const UClass* Class, FName VarName)
+{
+	if (!HasAccessors() || Class == nullptr)
+	{
+		return nullptr;
+	}
+
+	FRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+
+	BindPendingAccessors(Registry);
+	for (const UClass* Super = Class; Super != nullptr; Super = Super->GetSuperClass())
+	{
+		TUniquePtr<FVarAccessNativeBinding>* Binding = Registry.Bindings.Find(FBindingKey(Super, VarName));
+		if (Binding == nullptr)
+		{
+			continue;
+		}
+
+		if (!(*Binding)->bVerified && (*Binding)->RegisteredAccessor != nullptr)
+		{
+			VerifyBinding(Binding->Get());
+		}
+
+		return (*Binding)->Accessor.load() != nullptr ? Binding->Get() : nullptr;
+	}
+
+	return nullptr;
+}
+
+// Accessor which applies to the target, or nullptr.
+const FVarAccessNativeAccessor* GetAccessor(const FVarAccessNativeBinding& Binding, UObject* Target, FProperty* ExpectedProperty)
+{
+	const FVarAccessNativeAccessor* Accessor = Binding.Accessor.load(std::memory_order_acquire);
+	if (Accessor == nullptr || Target == nullptr || !Target->IsA(Binding.Class))
+	{
+		return nullptr;
+	}
+	if (ExpectedProperty != nullptr && ExpectedProperty != Binding.Property && !Binding.Property->SameType(ExpectedProperty))
+	{
+		return nullptr;
+	}
+
+	return Accessor;
+}
+
+TTuple<FProperty*, void*> Resolve(const FVarAccessNativeBinding& Binding, UObject* Target, FProperty* ExpectedProperty)
+{
+	const FVarAccessNativeAccessor* Accessor = GetAccessor(Binding, Target, ExpectedProperty);
+	if (Accessor == nullptr)
+	{
+		return TTuple<FProperty*, void*>(nullptr, nullptr);
+	}
+
+	return TTuple<FProperty*, void*>(Binding.Property, const_cast<void*>(Accessor->GetAddress(Target)));
+}
+
+bool Copy(const FVarAccessNativeBinding& Binding, UObject* Target, FProperty* Dest, void* DestAddr, FProperty* NewValue,
+	const void* NewValueAddr)
+{
+	const FVarAccessNativeAccessor* Accessor = GetAccessor(Binding, Target, Dest);
+	if (Accessor == nullptr || Dest == nullptr || DestAddr == nullptr)
+	{
+		return false;
+	}
+	if (NewValue != nullptr && NewValue != Dest && !Binding.Property->SameType(NewValue))
+	{
+		return false;
+	}
+
+	// The values are assigned as the C++ type of the member instead of FProperty::CopyCompleteValue.
+	if (NewValue != nullptr)
+	{
+		Accessor->Write(Target, NewValueAddr);
+	}
+	Accessor->Read(Target, DestAddr);
+
+	return true;
+}
+}	 // namespace FVariableAccessNativeAccessors
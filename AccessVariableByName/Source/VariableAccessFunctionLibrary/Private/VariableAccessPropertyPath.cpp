@@ -0,0 +1,134 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableAccessPropertyPath.h"
+
+#include "PropertyPathHelpers.h"
+
+namespace FVariableAccessPropertyPath
+{
+bool ToPropertyChain(const TArray<FVarDescription>& VarDescs, TArray<FString>* OutChain)
+{
+	OutChain->Reset(VarDescs.Num());
+	for (const FVarDescription& Desc : VarDescs)
+	{
+		if (!Desc.bIsValid)
+		{
+			return false;
+		}
+
+		switch (Desc.ArrayAccessType)
+		{
+			case EArrayAccessType::ArrayAccessType_None:
+				OutChain->Add(Desc.VarName);
+				break;
+			case EArrayAccessType::ArrayAccessType_Integer:
+				// The placeholder which is not substituted has no index.
+				if (Desc.ArrayAccessValue.Integer < 0)
+				{
+					return false;
+				}
+				OutChain->Add(FString::Printf(TEXT("%s[%d]"), *Desc.VarName, Desc.ArrayAccessValue.Integer));
+				break;
+			default:
+				return false;
+		}
+	}
+
+	return OutChain->Num() > 0;
+}
+
+bool ToCachedPropertyPath(const FString& VarName, FCachedPropertyPath* OutPath, const FVarAccessArguments& Arguments)
+{
+	TArray<FVarDescription> VarDescs;
+	if (!FVariableAccessFunctionLibraryUtils::ParseVarName(VarName, &VarDescs) ||
+		!FVariableAccessFunctionLibraryUtils::ApplyArguments(&VarDescs, Arguments))
+	{
+		return false;
+	}
+
+	TArray<FString> Chain;
+	if (!ToPropertyChain(VarDescs, &Chain))
+	{
+		return false;
+	}
+
+	*OutPath = FCachedPropertyPath(Chain);
+
+	return true;
+}
+
+bool FromCachedPropertyPath(const FCachedPropertyPath& Path, TArray<FVarDescription>* OutVarDescs)
+{
+	TArray<FString> Vars;
+	for (int32 Index = 0; Index < Path.GetNumSegments(); ++Index)
+	{
+		const FPropertyPathSegment& Segment = Path.GetSegment(Index);
+		if (Segment.GetArrayIndex() == INDEX_NONE)
+		{
+			Vars.Add(Segment.GetName().ToString());
+		}
+		else
+		{
+			Vars.Add(FString::Printf(TEXT("%s[%d]"), *Segment.GetName().ToString(), Segment.GetArrayIndex()));
+		}
+	}
+
+	// Parse by the grammar of this plugin, so that the descriptions are same as the ones of the same path in the string.
+	OutVarDescs->Reset();
+	FVariableAccessFunctionLibraryUtils::AnalyzeVarNames(Vars, OutVarDescs);
+	if (OutVarDescs->Num() == 0)
+	{
+		return false;
+	}
+	for (const FVarDescription& Desc : *OutVarDescs)
+	{
+		if (!Desc.bIsValid)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FString ToVarName(const TArray<FVarDescription>& VarDescs)
+{
+	FString VarName;
+	for (const FVarDescription& Desc : VarDescs)
+	{
+		if (!VarName.IsEmpty())
+		{
+			VarName += TEXT(".");
+		}
+		VarName += Desc.VarName;
+
+		switch (Desc.ArrayAccessType)
+		{
+			case EArrayAccessType::ArrayAccessType_Integer:
+				if (Desc.ArgumentIndex != INDEX_NONE && Desc.ArrayAccessValue.Integer < 0)
+				{
+					VarName += FString::Printf(TEXT("[{%d}]"), Desc.ArgumentIndex);
+				}
+				else
+				{
+					VarName += FString::Printf(TEXT("[%d]"), Desc.ArrayAccessValue.Integer);
+				}
+				break;
+			case EArrayAccessType::ArrayAccessType_String:
+				VarName += FString::Printf(TEXT("[\"%s\"]"), *Desc.ArrayAccessValue.String);
+				break;
+			default:
+				break;
+		}
+	}
+
+	return VarName;
+}
+}	 // namespace FVariableAccessPropertyPath
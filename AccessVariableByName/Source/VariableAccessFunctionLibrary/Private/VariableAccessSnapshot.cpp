@@ -0,0 +1,259 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableAccessSnapshot.h"
+
+#include "CoreGlobals.h"
+#include "Templates/AlignmentTemplates.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+
+// Alignment of the value buffer, which is enough for the values of all property types.
+const uint32 SnapshotDataAlignment = 16;
+
+FVarAccessSnapshotBuffer::~FVarAccessSnapshotBuffer()
+{
+	DestroyValues();
+	FMemory::Free(Data);
+}
+
+TTuple<const FProperty*, const void*> FVarAccessSnapshotBuffer::Find(FVarAccessSnapshotHandle Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.Index))
+	{
+		return TTuple<const FProperty*, const void*>(nullptr, nullptr);
+	}
+
+	const FSlot& Slot = Slots[Handle.Index];
+	if (!Slot.bCaptured || Slot.Serial != Handle.Serial)
+	{
+		return TTuple<const FProperty*, const void*>(nullptr, nullptr);
+	}
+
+	return TTuple<const FProperty*, const void*>(Slot.Property, Data + Slot.Offset);
+}
+
+void FVarAccessSnapshotBuffer::DestroyValues()
+{
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.bCaptured)
+		{
+			Slot.Property->DestroyValue(Data + Slot.Offset);
+			Slot.bCaptured = false;
+		}
+	}
+}
+
+FVarAccessSnapshot::FVarAccessSnapshot()
+{
+	PreGarbageCollectHandle =
+		FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FVarAccessSnapshot::OnPreGarbageCollect);
+}
+
+FVarAccessSnapshot::~FVarAccessSnapshot()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+}
+
+FVarAccessSnapshotHandle FVarAccessSnapshot::AddVariable(
+	UObject* Target, const FString& VarName, FProperty* ValueProperty, const FAccessVariableParams& Params)
+{
+	check(IsInGameThread());
+
+	FVarAccessSnapshotHandle Handle;
+
+	FEntry Entry;
+	if (!FVariableAccessFunctionLibraryUtils::ParseVarName(VarName, &Entry.Chain.VarDescs))
+	{
+		return Handle;
+	}
+	Entry.Chain.Links.SetNum(Entry.Chain.VarDescs.Num());
+	Entry.Target = Target;
+	Entry.ValueProperty = ValueProperty;
+	Entry.Params = Params;
+	// Capturing must not change the target.
+	Entry.Params.bExtendIfNotPresent = false;
+	Entry.Serial = NextSerial++;
+
+	Handle.Serial = Entry.Serial;
+	Handle.Index = Entries.Add(MoveTemp(Entry));
+
+	return Handle;
+}
+
+void FVarAccessSnapshot::RemoveVariable(FVarAccessSnapshotHandle Handle)
+{
+	check(IsInGameThread());
+
+	if (Entries.IsValidIndex(Handle.Index) && Entries[Handle.Index].Serial == Handle.Serial)
+	{
+		Entries.RemoveAt(Handle.Index);
+	}
+}
+
+bool FVarAccessSnapshot::Capture()
+{
+	check(IsInGameThread());
+
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+	ReleaseBuffers(false);
+
+	// The buffer which is not published and not held by any reader can be rewritten.
+	// A reader which acquires it after this check finds that it is not published, and releases it without reading.
+	const int32 Published = PublishedIndex.load();
+	int32 BufferIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < NumBuffers; ++Index)
+	{
+		if (Index != Published && Buffers[Index].NumReaders.load() == 0)
+		{
+			BufferIndex = Index;
+			break;
+		}
+	}
+	if (BufferIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (ChainsEpoch != Epoch)
+	{
+		for (FEntry& Entry : Entries)
+		{
+			FVarAccessChain& Chain = Entry.Chain;
+			Chain.Links.Reset();
+			Chain.Links.SetNum(Chain.VarDescs.Num());
+			Chain.ObjectChains.Reset();
+			Chain.NextObjectChain = 0;
+		}
+		ChainsEpoch = Epoch;
+	}
+
+	FVarAccessSnapshotBuffer& Buffer = Buffers[BufferIndex];
+	Buffer.DestroyValues();
+	Buffer.Slots.Reset();
+	Buffer.Slots.SetNum(Entries.GetMaxIndex());
+	SourceAddrs.Reset();
+	SourceAddrs.SetNumZeroed(Entries.GetMaxIndex());
+
+	// Resolve all variables first to lay out the values.
+	int32 DataSize = 0;
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FEntry& Entry = *It;
+		FVarAccessSnapshotBuffer::FSlot& Slot = Buffer.Slots[It.GetIndex()];
+		Slot.Serial = Entry.Serial;
+
+		UObject* Target = Entry.Target.Get();
+		if (Target == nullptr)
+		{
+			continue;
+		}
+		TTuple<FProperty*, void*> Terminal =
+			FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(&Entry.Chain, Target, Entry.ValueProperty, Entry.Params);
+		if (Terminal.Get<0>() == nullptr || Terminal.Get<1>() == nullptr)
+		{
+			continue;
+		}
+
+		const FProperty* Property = Entry.ValueProperty != nullptr ? Entry.ValueProperty : Terminal.Get<0>();
+		DataSize = Align(DataSize, Property->GetMinAlignment());
+		Slot.Property = Property;
+		Slot.Offset = DataSize;
+		DataSize += Property->GetSize();
+		SourceAddrs[It.GetIndex()] = Terminal.Get<1>();
+	}
+
+	if (DataSize > Buffer.DataCapacity)
+	{
+		FMemory::Free(Buffer.Data);
+		Buffer.Data = static_cast<uint8*>(FMemory::Malloc(DataSize, SnapshotDataAlignment));
+		Buffer.DataCapacity = DataSize;
+	}
+
+	for (int32 Index = 0; Index < Buffer.Slots.Num(); ++Index)
+	{
+		FVarAccessSnapshotBuffer::FSlot& Slot = Buffer.Slots[Index];
+		if (SourceAddrs[Index] != nullptr)
+		{
+			Slot.Property->InitializeValue(Buffer.Data + Slot.Offset);
+			Slot.Property->CopyCompleteValue(Buffer.Data + Slot.Offset, SourceAddrs[Index]);
+			Slot.bCaptured = true;
+		}
+	}
+	Buffer.FrameNumber = GFrameCounter;
+	Buffer.Epoch = Epoch;
+
+	PublishedIndex.store(BufferIndex);
+
+	return true;
+}
+
+void FVarAccessSnapshot::ReleaseBuffers(bool bAll)
+{
+	check(IsInGameThread());
+
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+	const int32 Published = PublishedIndex.load();
+	if (Published != INDEX_NONE && (bAll || Buffers[Published].Epoch != Epoch))
+	{
+		// Unpublish first, so that a reader which acquires the buffer after the check below releases it without reading.
+		PublishedIndex.store(INDEX_NONE);
+	}
+
+	for (FVarAccessSnapshotBuffer& Buffer : Buffers)
+	{
+		if ((bAll || Buffer.Epoch != Epoch) && Buffer.NumReaders.load() == 0)
+		{
+			Buffer.DestroyValues();
+			Buffer.Slots.Reset();
+			Buffer.Epoch = Epoch;
+		}
+	}
+}
+
+void FVarAccessSnapshot::OnPreGarbageCollect()
+{
+	// The garbage collection may destroy the properties of the captured values even if the caches are not invalidated (e.g.
+	// the class of a target is unloaded). The next capture publishes the values again.
+	ReleaseBuffers(true);
+}
+
+const FVarAccessSnapshotBuffer* FVarAccessSnapshot::AcquireBuffer() const
+{
+	for (;;)
+	{
+		const int32 Index = PublishedIndex.load();
+		if (Index == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		// Retry if the buffer is unpublished before it is held, since the game thread may be rewriting it.
+		const FVarAccessSnapshotBuffer& Buffer = Buffers[Index];
+		++Buffer.NumReaders;
+		if (PublishedIndex.load() == Index)
+		{
+			return &Buffer;
+		}
+		--Buffer.NumReaders;
+	}
+}
+
+FVarAccessSnapshot::FReadScope::FReadScope(const FVarAccessSnapshot& Snapshot) : Buffer(Snapshot.AcquireBuffer())
+{
+}
+
+FVarAccessSnapshot::FReadScope::~FReadScope()
+{
+	if (Buffer != nullptr)
+	{
+		--Buffer->NumReaders;
+	}
+}
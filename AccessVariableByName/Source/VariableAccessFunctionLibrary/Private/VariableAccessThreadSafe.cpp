@@ -0,0 +1,304 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableAccessThreadSafe.h"
+
+#include "UObject/UnrealType.h"
+
+#include <atomic>
+
+namespace FVariableAccessThreadSafe
+{
+// Parsed path and the properties resolved from a class. Never changed after it is published.
+struct FThreadSafeChainEntry
+{
+	const UClass* Class = nullptr;
+	FName VarName;
+	bool bIncludeGenerationClass = false;
+	uint32 Epoch = 0;
+	// The path is not supported on this version of the plugin, and is never resolved.
+	bool bUnsupported = false;
+	bool bAccessesContainer = false;
+	TArray<FVarDescription> VarDescs;
+	TArray<FVarAccessLink> Links;
+	// The variable is reached only through structure members, and lives at this offset from the target.
+	bool bInlineMemory = false;
+	int32 InlineOffset = 0;
+	FProperty* InlineProperty = nullptr;
+};
+
+// Open addressing table whose slots are filled once by compare-and-swap, so that readers never lock.
+const int32 NumChainSlots = 1024;
+const int32 MaxChainProbes = 8;
+
+struct FThreadSafeChainTable
+{
+	std::atomic<FThreadSafeChainEntry*> Slots[NumChainSlots];
+
+	FThreadSafeChainTable()
+	{
+		for (std::atomic<FThreadSafeChainEntry*>& Slot : Slots)
+		{
+			Slot.store(nullptr);
+		}
+	}
+
+	~FThreadSafeChainTable()
+	{
+		for (std::atomic<FThreadSafeChainEntry*>& Slot : Slots)
+		{
+			delete Slot.load();
+		}
+	}
+};
+
+// The table is replaced on the game thread whenever the caches are invalidated, so that the stale entries never occupy the
+// slots of the live table. The replaced tables are deleted when no reader is running, since a reader which started before
+// the replacement may still see them.
+struct FThreadSafeChainCache
+{
+	std::atomic<FThreadSafeChainTable*> Table{new FThreadSafeChainTable()};
+	std::atomic<int32> NumReaders{0};
+	// Touched only on the game thread.
+	TArray<FThreadSafeChainTable*> RetiredTables;
+
+	~FThreadSafeChainCache()
+	{
+		delete Table.load();
+		for (FThreadSafeChainTable* RetiredTable : RetiredTables)
+		{
+			delete RetiredTable;
+		}
+	}
+};
+
+FThreadSafeChainCache ChainCache;
+
+struct FChainCacheReadScope
+{
+	FChainCacheReadScope()
+	{
+		++ChainCache.NumReaders;
+	}
+
+	~FChainCacheReadScope()
+	{
+		--ChainCache.NumReaders;
+	}
+};
+
+FRWLock& GetContainerLock()
+{
+	static FRWLock ContainerLock;
+	return ContainerLock;
+}
+
+uint32 GetChainHash(const UClass* Class, FName VarName, bool bIncludeGenerationClass)
+{
+	return HashCombine(HashCombine(GetTypeHash(Class), GetTypeHash(VarName)), bIncludeGenerationClass ? 1 : 0);
+}
+
+bool IsInlineChain(const FThreadSafeChainEntry& Entry)
+{
+	if (Entry.bAccessesContainer)
+	{
+		return false;
+	}
+	for (int32 VarDepth = 0; VarDepth < Entry.Links.Num(); ++VarDepth)
+	{
+		const FVarAccessLink& Link = Entry.Links[VarDepth];
+		if (Link.Property == nullptr || Link.bGenerationClass)
+		{
+			return false;
+		}
+		if (VarDepth + 1 < Entry.Links.Num() && !Link.Property->IsA<FStructProperty>())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool IsSameChain(const FThreadSafeChainEntry& Entry, const UClass* Class, FName VarName, bool bIncludeGenerationClass)
+{
+	return Entry.Class == Class && Entry.VarName == VarName && Entry.bIncludeGenerationClass == bIncludeGenerationClass;
+}
+
+// Return the published entry, or the new entry built on Built if the path is not cached yet.
+const FThreadSafeChainEntry* FindOrAddChain(UObject* Target, FName VarName, const FAccessVariableParams& Params,
+	const FContainerReadScope* ContainerReadScope, TUniquePtr<FThreadSafeChainEntry>* Built,
+	TTuple<FProperty*, void*>* BuiltTerminal)
+{
+	const UClass* Class = Target->GetClass();
+	const uint32 Hash = GetChainHash(Class, VarName, Params.bIncludeGenerationClass);
+	// The table is loaded before the epoch. The epoch is incremented before the table is replaced, so an entry of the old
+	// epoch is never published to the new table.
+	FThreadSafeChainTable* Table = ChainCache.Table.load();
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+
+	int32 FreeSlot = INDEX_NONE;
+	for (int32 Probe = 0; Probe < MaxChainProbes; ++Probe)
+	{
+		const int32 SlotIndex = (Hash + Probe) % NumChainSlots;
+		FThreadSafeChainEntry* Entry = Table->Slots[SlotIndex].load();
+		if (Entry == nullptr)
+		{
+			FreeSlot = SlotIndex;
+			break;
+		}
+		if (IsSameChain(*Entry, Class, VarName, Params.bIncludeGenerationClass) && Entry->Epoch == Epoch)
+		{
+			return Entry;
+		}
+	}
+
+	TUniquePtr<FThreadSafeChainEntry> NewEntry = MakeUnique<FThreadSafeChainEntry>();
+	NewEntry->Class = Class;
+	NewEntry->VarName = VarName;
+	NewEntry->bIncludeGenerationClass = Params.bIncludeGenerationClass;
+	NewEntry->Epoch = Epoch;
+	// Parse on the stack, so that a miss on a worker thread does not allocate a temporary string.
+	FNameBuilder VarNameBuilder(VarName);
+	NewEntry->bUnsupported = !FVariableAccessFunctionLibraryUtils::ParseVarName(VarNameBuilder.ToView(), &NewEntry->VarDescs);
+	for (const FVarDescription& Desc : NewEntry->VarDescs)
+	{
+		NewEntry->bAccessesContainer |= Desc.ArrayAccessType != EArrayAccessType::ArrayAccessType_None;
+	}
+	NewEntry->Links.SetNum(NewEntry->VarDescs.Num());
+
+	// Resolve once before publishing, so that the published links are not written anymore.
+	// The refused path is not resolved, and its entry is not published.
+	const bool bRefused = NewEntry->bUnsupported || (NewEntry->bAccessesContainer && ContainerReadScope == nullptr);
+	if (!bRefused)
+	{
+		*BuiltTerminal = FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(
+			NewEntry->VarDescs, 0, Target, nullptr, Params, NewEntry->Links.GetData());
+		if (BuiltTerminal->Get<0>() != nullptr && IsInlineChain(*NewEntry))
+		{
+			NewEntry->bInlineMemory = true;
+			NewEntry->InlineOffset = (int32) (static_cast<uint8*>(BuiltTerminal->Get<1>()) - reinterpret_cast<uint8*>(Target));
+			NewEntry->InlineProperty = BuiltTerminal->Get<0>();
+		}
+	}
+
+	if (FreeSlot != INDEX_NONE && !bRefused)
+	{
+		FThreadSafeChainEntry* Expected = nullptr;
+		if (Table->Slots[FreeSlot].compare_exchange_strong(Expected, NewEntry.Get()))
+		{
+			return NewEntry.Release();
+		}
+	}
+
+	// The table is full around the hash or another thread has published the same slot. Use the entry only for this read.
+	*Built = MoveTemp(NewEntry);
+	return Built->Get();
+}
+
+TTuple<FProperty*, void*> ResolveVariableInternal(UObject* Target, FName VarName, const FAccessVariableParams& Params,
+	const FContainerReadScope* ContainerReadScope, bool bInlineOnly)
+{
+	const TTuple<FProperty*, void*> NullReturn(nullptr, nullptr);
+
+	if (Target == nullptr)
+	{
+		return NullReturn;
+	}
+
+	FAccessVariableParams ReadParams = Params;
+	ReadParams.bExtendIfNotPresent = false;
+	ReadParams.bCacheObjectChain = false;
+
+	FChainCacheReadScope ReadScope;
+	TUniquePtr<FThreadSafeChainEntry> Built;
+	TTuple<FProperty*, void*> BuiltTerminal = NullReturn;
+	const FThreadSafeChainEntry* Entry = FindOrAddChain(Target, VarName, ReadParams, ContainerReadScope, &Built, &BuiltTerminal);
+	if (Entry->bUnsupported || (Entry->bAccessesContainer && ContainerReadScope == nullptr))
+	{
+		return NullReturn;
+	}
+	if (Entry->bInlineMemory)
+	{
+		return TTuple<FProperty*, void*>(Entry->InlineProperty, reinterpret_cast<uint8*>(Target) + Entry->InlineOffset);
+	}
+	if (bInlineOnly)
+	{
+		return NullReturn;
+	}
+	if (BuiltTerminal.Get<0>() != nullptr)
+	{
+		return BuiltTerminal;
+	}
+
+	// The links of the other classes on the path are filled on a copy.
+	TArray<FVarAccessLink, TInlineAllocator<8>> Links(Entry->Links);
+
+	return FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(
+		Entry->VarDescs, 0, Target, nullptr, ReadParams, Links.GetData());
+}
+
+TTuple<FProperty*, void*> ResolveVariable(
+	UObject* Target, FName VarName, const FAccessVariableParams& Params, const FContainerReadScope* ContainerReadScope)
+{
+	return ResolveVariableInternal(Target, VarName, Params, ContainerReadScope, false);
+}
+
+TTuple<FProperty*, void*> ResolveInlineVariable(UObject* Target, FName VarName, const FAccessVariableParams& Params)
+{
+	return ResolveVariableInternal(Target, VarName, Params, nullptr, true);
+}
+
+bool GenericGetNestedVariableByName(UObject* Target, FName VarName, FProperty* ResultProperty, void* ResultAddr,
+	const FAccessVariableParams& Params, const FContainerReadScope* ContainerReadScope)
+{
+	if (ResultProperty == nullptr || ResultAddr == nullptr)
+	{
+		return false;
+	}
+
+	FGCScopeGuard GCGuard;
+
+	TTuple<FProperty*, void*> Terminal = ResolveVariable(Target, VarName, Params, ContainerReadScope);
+	FProperty* TerminalProperty = Terminal.Get<0>();
+	if (TerminalProperty == nullptr || Terminal.Get<1>() == nullptr || !TerminalProperty->SameType(ResultProperty))
+	{
+		return false;
+	}
+
+	ResultProperty->CopyCompleteValue(ResultAddr, Terminal.Get<1>());
+
+	return true;
+}
+
+void ResetCache()
+{
+	check(IsInGameThread());
+
+	ChainCache.RetiredTables.Add(ChainCache.Table.exchange(new FThreadSafeChainTable()));
+
+	// A reader which starts after the replacement sees only the new table. If the readers which started before are still
+	// running, the retired tables are deleted on a later invalidation.
+	if (ChainCache.NumReaders.load() == 0)
+	{
+		for (FThreadSafeChainTable* RetiredTable : ChainCache.RetiredTables)
+		{
+			delete RetiredTable;
+		}
+		ChainCache.RetiredTables.Reset();
+	}
+}
+
+int32 GetNumRetiredTables()
+{
+	check(IsInGameThread());
+
+	return ChainCache.RetiredTables.Num();
+}
+}	 // namespace FVariableAccessThreadSafe
@@ -0,0 +1,251 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableAccessWriteBuffer.h"
+
+#include "Templates/AlignmentTemplates.h"
+#include "UObject/UnrealType.h"
+
+TSharedPtr<FVarAccessWritePath, ESPMode::ThreadSafe> FVarAccessWritePath::Create(
+	const FString& VarName, FProperty* ValueProperty, const FAccessVariableParams& Params, FMergeFunction Merge)
+{
+	check(IsInGameThread());
+
+	if (ValueProperty == nullptr)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FVarAccessWritePath, ESPMode::ThreadSafe> Path = MakeShared<FVarAccessWritePath, ESPMode::ThreadSafe>();
+	if (!FVariableAccessFunctionLibraryUtils::ParseVarName(VarName, &Path->VarDescs))
+	{
+		return nullptr;
+	}
+	Path->ValueProperty = ValueProperty;
+	Path->Params = Params;
+	Path->Merge = MoveTemp(Merge);
+
+	return Path;
+}
+
+FVarAccessChain* FVarAccessWritePath::FindChain(const UClass* Class)
+{
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+	if (ChainsEpoch != Epoch)
+	{
+		Chains.Reset();
+		ChainsEpoch = Epoch;
+	}
+
+	FVarAccessChain* Chain = Chains.Find(Class);
+	if (Chain == nullptr)
+	{
+		Chain = &Chains.Add(Class);
+		Chain->VarDescs = VarDescs;
+		Chain->Links.SetNum(VarDescs.Num());
+	}
+
+	return Chain;
+}
+
+FVarAccessWriteBuffer::FBlock::~FBlock()
+{
+	for (const FCommand& Command : Commands)
+	{
+		Command.Path->GetValueProperty()->DestroyValue(Values.GetData() + Command.ValueOffset);
+	}
+}
+
+FVarAccessWriteBuffer::~FVarAccessWriteBuffer()
+{
+	FBlock* Block = Head.exchange(nullptr);
+	while (Block != nullptr)
+	{
+		FBlock* Next = Block->Next;
+		delete Block;
+		Block = Next;
+	}
+}
+
+void FVarAccessWriteBuffer::Push(FBlock* Block)
+{
+	FBlock* OldHead = Head.load();
+	do
+	{
+		Block->Next = OldHead;
+	} while (!Head.compare_exchange_weak(OldHead, Block));
+}
+
+FVarAccessWriteBuffer::FWriter::FWriter(FVarAccessWriteBuffer& InBuffer) : Buffer(InBuffer)
+{
+}
+
+FVarAccessWriteBuffer::FWriter::~FWriter()
+{
+	Submit();
+}
+
+uint64 FVarAccessWriteBuffer::FWriter::EnqueueValue(UObject* Target, FVarAccessWritePath& Path, const void* ValueAddr)
+{
+	if (Target == nullptr || ValueAddr == nullptr)
+	{
+		return 0;
+	}
+
+	if (Block == nullptr)
+	{
+		Block = new FBlock();
+	}
+
+	const FProperty* ValueProperty = Path.GetValueProperty();
+	const int32 ValueOffset = Align(Block->Values.Num(), ValueProperty->GetMinAlignment());
+	Block->Values.SetNumUninitialized(ValueOffset + ValueProperty->GetSize());
+	uint8* Value = Block->Values.GetData() + ValueOffset;
+	ValueProperty->InitializeValue(Value);
+	ValueProperty->CopyCompleteValue(Value, ValueAddr);
+
+	FCommand& Command = Block->Commands.AddDefaulted_GetRef();
+	Command.Target = Target;
+	Command.Path = &Path;
+	Command.ValueOffset = ValueOffset;
+	Command.WriteId = Buffer.NextWriteId++;
+
+	return Command.WriteId;
+}
+
+void FVarAccessWriteBuffer::FWriter::Submit()
+{
+	if (Block != nullptr)
+	{
+		Buffer.Push(Block);
+		Block = nullptr;
+	}
+}
+
+int32 FVarAccessWriteBuffer::Flush(TArray<FVarAccessWriteResult>* OutResults)
+{
+	check(IsInGameThread());
+
+	struct FPendingWrite
+	{
+		UObject* Target;
+		FVarAccessWritePath* Path;
+		void* ValueAddr;
+		uint64 WriteId;
+	};
+
+	FBlock* Blocks = Head.exchange(nullptr);
+
+	TArray<FPendingWrite> Writes;
+	for (FBlock* Block = Blocks; Block != nullptr; Block = Block->Next)
+	{
+		for (const FCommand& Command : Block->Commands)
+		{
+			FPendingWrite& Write = Writes.AddDefaulted_GetRef();
+			Write.Target = Command.Target.Get();
+			Write.Path = Command.Path;
+			Write.ValueAddr = Block->Values.GetData() + Command.ValueOffset;
+			Write.WriteId = Command.WriteId;
+		}
+	}
+
+	// Writes to the same variable of the same object become adjacent, in the order of enqueue.
+	Writes.Sort(
+		[](const FPendingWrite& A, const FPendingWrite& B)
+		{
+			if (A.Target != B.Target)
+			{
+				return A.Target < B.Target;
+			}
+			if (A.Path != B.Path)
+			{
+				return A.Path < B.Path;
+			}
+			return A.WriteId < B.WriteId;
+		});
+
+	if (OutResults != nullptr)
+	{
+		OutResults->Reset(Writes.Num());
+	}
+	auto AddResults = [OutResults, &Writes](int32 Begin, int32 End, EVarAccessWriteStatus Status)
+	{
+		if (OutResults == nullptr)
+		{
+			return;
+		}
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			FVarAccessWriteResult& Result = OutResults->AddDefaulted_GetRef();
+			Result.WriteId = Writes[Index].WriteId;
+			Result.Status = Status;
+		}
+	};
+
+	int32 NumWritten = 0;
+	int32 Begin = 0;
+	while (Begin < Writes.Num())
+	{
+		const FPendingWrite& First = Writes[Begin];
+		int32 End = Begin + 1;
+		while (End < Writes.Num() && Writes[End].Target == First.Target && Writes[End].Path == First.Path)
+		{
+			++End;
+		}
+
+		UObject* Target = First.Target;
+		FVarAccessWritePath* Path = First.Path;
+		if (Target == nullptr)
+		{
+			AddResults(Begin, End, EVarAccessWriteStatus::InvalidTarget);
+			Begin = End;
+			continue;
+		}
+
+		TTuple<FProperty*, void*> Terminal = FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(
+			Path->FindChain(Target->GetClass()), Target, Path->ValueProperty, Path->Params);
+		FProperty* TerminalProperty = Terminal.Get<0>();
+		void* TerminalAddr = Terminal.Get<1>();
+		if (TerminalProperty == nullptr || TerminalAddr == nullptr)
+		{
+			AddResults(Begin, End, EVarAccessWriteStatus::NotFound);
+			Begin = End;
+			continue;
+		}
+
+		if (Path->Merge)
+		{
+			// Merge into the first value, which is owned by the block and destroyed with it.
+			void* Accumulated = First.ValueAddr;
+			for (int32 Index = Begin + 1; Index < End; ++Index)
+			{
+				Path->Merge(Path->ValueProperty, Accumulated, Writes[Index].ValueAddr);
+			}
+			TerminalProperty->CopyCompleteValue(TerminalAddr, Accumulated);
+			AddResults(Begin, End, EVarAccessWriteStatus::Written);
+		}
+		else
+		{
+			TerminalProperty->CopyCompleteValue(TerminalAddr, Writes[End - 1].ValueAddr);
+			AddResults(Begin, End - 1, EVarAccessWriteStatus::Superseded);
+			AddResults(End - 1, End, EVarAccessWriteStatus::Written);
+		}
+		++NumWritten;
+		Begin = End;
+	}
+
+	while (Blocks != nullptr)
+	{
+		FBlock* Next = Blocks->Next;
+		delete Blocks;
+		Blocks = Next;
+	}
+
+	return NumWritten;
+}
@@ -0,0 +1,313 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableArrayFunctionLibrary.h"
+
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UnrealType.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessThreadSafe.h"
+
+static TTuple<FArrayProperty*, void*> FindArrayByName(UObject* Target, FName VarName, const FAccessVariableParams& Params)
+{
+	const TTuple<FArrayProperty*, void*> NullReturn(nullptr, nullptr);
+
+#ifdef AVBN_FREE_VERSION
+	UE_LOG(LogTemp, Error,
+		TEXT("The operation of Array is not supported on the free version. Please consider to buy full version at Fab."));
+	return NullReturn;
+#else
+	// Convert on the stack, so that a repeated access does not allocate.
+	FNameBuilder VarNameBuilder(VarName);
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindThreadChain(Target, VarNameBuilder.ToView(), Params);
+	if (Chain == nullptr)
+	{
+		return NullReturn;
+	}
+
+	TTuple<FProperty*, void*> Terminal =
+		FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(Chain, Target, nullptr, Params);
+	FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Terminal.Get<0>());
+	if (ArrayProperty == nullptr || Terminal.Get<1>() == nullptr)
+	{
+		return NullReturn;
+	}
+
+	return TTuple<FArrayProperty*, void*>(ArrayProperty, Terminal.Get<1>());
+#endif
+}
+
+int32 UVariableArrayFunctionLibrary::GenericArrayAddByName(UObject* Target, FName VarName, bool& Success,
+	FProperty* NewItemProperty, void* NewItemAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	FArrayProperty* ArrayProperty = Array.Get<0>();
+	if (ArrayProperty == nullptr || NewItemProperty == nullptr || NewItemAddr == nullptr)
+	{
+		return INDEX_NONE;
+	}
+	if (!ArrayProperty->Inner->SameType(NewItemProperty))
+	{
+		return INDEX_NONE;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProperty, Array.Get<1>());
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	int32 Index = ArrayHelper.AddValue();
+	ArrayProperty->Inner->CopySingleValue(ArrayHelper.GetRawPtr(Index), NewItemAddr);
+
+	Success = true;
+	return Index;
+}
+
+int32 UVariableArrayFunctionLibrary::GenericArrayAddUniqueByName(UObject* Target, FName VarName, bool& Success,
+	FProperty* NewItemProperty, void* NewItemAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	FArrayProperty* ArrayProperty = Array.Get<0>();
+	if (ArrayProperty == nullptr || NewItemProperty == nullptr || NewItemAddr == nullptr)
+	{
+		return INDEX_NONE;
+	}
+	if (!ArrayProperty->Inner->SameType(NewItemProperty))
+	{
+		return INDEX_NONE;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProperty, Array.Get<1>());
+	for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+	{
+		if (ArrayProperty->Inner->Identical(ArrayHelper.GetRawPtr(Index), NewItemAddr))
+		{
+			Success = true;
+			return Index;
+		}
+	}
+
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	int32 Index = ArrayHelper.AddValue();
+	ArrayProperty->Inner->CopySingleValue(ArrayHelper.GetRawPtr(Index), NewItemAddr);
+
+	Success = true;
+	return Index;
+}
+
+void UVariableArrayFunctionLibrary::GenericArrayInsertByName(UObject* Target, FName VarName, int32 Index, bool& Success,
+	FProperty* NewItemProperty, void* NewItemAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	FArrayProperty* ArrayProperty = Array.Get<0>();
+	if (ArrayProperty == nullptr || NewItemProperty == nullptr || NewItemAddr == nullptr)
+	{
+		return;
+	}
+	if (!ArrayProperty->Inner->SameType(NewItemProperty))
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProperty, Array.Get<1>());
+	if (Index < 0 || Index > ArrayHelper.Num())
+	{
+		return;
+	}
+
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	ArrayHelper.InsertValues(Index, 1);
+	ArrayProperty->Inner->CopySingleValue(ArrayHelper.GetRawPtr(Index), NewItemAddr);
+
+	Success = true;
+}
+
+	if (!Success && ItemProperty != nullptr && ItemAddr != nullptr)
+	{
+		ItemProperty->ClearValue(ItemAddr);
+	}
+}
+
+void UVariableArrayFunctionLibrary::GenericArrayGetByView(
+	const FVarAccessContainerView& View, int32 Index, bool& Success, FProperty* ItemProperty, void* ItemAddr)
+{
+	Success = false;
+
+	// The property of the view is valid only while the view is resolved.
+	void* ArrayAddr = FVariableAccessFunctionLibraryUtils::ResolveContainerView(View);
+	FArrayProperty* ArrayProperty = ArrayAddr != nullptr ? CastField<FArrayProperty>(View.Property) : nullptr;
+	if (ArrayProperty != nullptr && ItemProperty != nullptr && ItemAddr != nullptr && ArrayProperty->Inner->SameType(ItemProperty))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayAddr);
+		if (ArrayHelper.IsValidIndex(Index))
+		{
+			ArrayProperty->Inner->CopySingleValue(ItemAddr, ArrayHelper.GetRawPtr(Index));
+			Success = true;
+		}
+	}
+
+	if (!Success && ItemProperty != nullptr && ItemAddr != nullptr)
+	{
+		ItemProperty->ClearValue(ItemAddr);
+	}
+}
+
+int32 UVariableArrayFunctionLibrary::ArrayViewByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, FVarAccessContainerView& View)
+{
+	Success = false;
+	View = FVarAccessContainerView();
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	if (Array.Get<0>() == nullptr)
+	{
+		return 0;
+	}
+
+	View = FVariableAccessFunctionLibraryUtils::MakeContainerView(Target, VarName, Params, Array.Get<0>(), Array.Get<1>());
+	FScriptArrayHelper ArrayHelper(Array.Get<0>(), Array.Get<1>());
+
+	Success = true;
+	return ArrayHelper.Num();
+}
+
+void UVariableArrayFunctionLibrary::ArrayGetByView(
+	const FVarAccessContainerView& View, int32 Index, bool& Success, UProperty*& Item)
+{
+	check(0);
+}
+
+int32 UVariableArrayFunctionLibrary::ArrayAddByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* NewItem)
+{
+	check(0);
+	return INDEX_NONE;
+}
+
+int32 UVariableArrayFunctionLibrary::ArrayAddUniqueByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* NewItem)
+{
+	check(0);
+	return INDEX_NONE;
+}
+
+void UVariableArrayFunctionLibrary::ArrayInsertByName(
+	UObject* Target, FName VarName, int32 Index, FAccessVariableParams Params, bool& Success, UProperty* NewItem)
+{
+	check(0);
+}
+
+void UVariableArrayFunctionLibrary::ArrayRemoveAtByName(
+	UObject* Target, FName VarName, int32 Index, FAccessVariableParams Params, bool& Success)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	if (Array.Get<0>() == nullptr)
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(Array.Get<0>(), Array.Get<1>());
+	if (!ArrayHelper.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	ArrayHelper.RemoveValues(Index, 1);
+
+	Success = true;
+}
+
+void UVariableArrayFunctionLibrary::ArrayRemoveAtSwapByName(
+	UObject* Target, FName VarName, int32 Index, FAccessVariableParams Params, bool& Success)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	if (Array.Get<0>() == nullptr)
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(Array.Get<0>(), Array.Get<1>());
+	if (!ArrayHelper.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	int32 LastIndex = ArrayHelper.Num() - 1;
+	if (Index != LastIndex)
+	{
+		ArrayHelper.SwapValues(Index, LastIndex);
+	}
+	ArrayHelper.RemoveValues(LastIndex, 1);
+
+	Success = true;
+}
+
+void UVariableArrayFunctionLibrary::ArrayEmptyByName(
+	UObject* Target, FName VarName, int32 Slack, FAccessVariableParams Params, bool& Success)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	if (Array.Get<0>() == nullptr)
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(Array.Get<0>(), Array.Get<1>());
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	ArrayHelper.EmptyValues(FMath::Max(Slack, 0));
+
+	Success = true;
+}
+
+void UVariableArrayFunctionLibrary::ArrayReserveByName(
+	UObject* Target, FName VarName, int32 Number, FAccessVariableParams Params, bool& Success)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	if (Array.Get<0>() == nullptr)
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(Array.Get<0>(), Array.Get<1>());
+	if (ArrayHelper.Num() == 0 && Number > 0)
+	{
+		FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+		ArrayHelper.EmptyValues(Number);
+	}
+
+	Success = true;
+}
+
+int32 UVariableArrayFunctionLibrary::ArrayNumByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success)
+{
+	Success = false;
+
+	TTuple<FArrayProperty*, void*> Array = FindArrayByName(Target, VarName, Params);
+	if (Array.Get<0>() == nullptr)
+	{
+		return 0;
+	}
+
+	FScriptArrayHelper ArrayHelper(Array.Get<0>(), Array.Get<1>());
+
+	Success = true;
+	return ArrayHelper.Num();
+}
@@ -0,0 +1,417 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableBulkAccessFunctionLibrary.h"
+
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "LatentActions.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UnrealType.h"
+
+// The budget is checked after processing this number of targets, since reading the clock costs more than an access.
+const int32 BudgetCheckInterval = 16;
+
+// Bulk operations started with a name, so that Blueprint can query the progress and cancel them.
+static TMap<FName, TWeakPtr<FVarAccessBulkOperation>> NamedBulkOperations;
+
+FVarAccessBulkOperation::FVarAccessBulkOperation(EVarAccessJobMode InMode, const TArray<TWeakObjectPtr<UObject>>& InTargets,
+	const FString& VarName, FProperty* InValueProperty, const void* NewValueAddr, const FAccessVariableParams& InParams)
+	: Mode(InMode), Targets(InTargets), ValueProperty(InValueProperty), Params(InParams)
+{
+	Succeeded.Init(false, Targets.Num());
+
+	if (ValueProperty == nullptr || (Mode == EVarAccessJobMode::Set && NewValueAddr == nullptr))
+	{
+		return;
+	}
+	bIsValidPath = FVariableAccessFunctionLibraryUtils::ParseVarName(VarName, &VarDescs);
+	if (!bIsValidPath)
+	{
+		return;
+	}
+
+	const int32 NumValues = Mode == EVarAccessJobMode::Set ? 1 : Targets.Num();
+	const int32 ValueSize = ValueProperty->GetSize();
+	Values = static_cast<uint8*>(FMemory::Malloc(FMath::Max(NumValues * ValueSize, 1), ValueProperty->GetMinAlignment()));
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		ValueProperty->InitializeValue(Values + Index * ValueSize);
+	}
+	if (Mode == EVarAccessJobMode::Set)
+	{
+		ValueProperty->CopyCompleteValue(Values, NewValueAddr);
+	}
+}
+
+FVarAccessBulkOperation::~FVarAccessBulkOperation()
+{
+	if (Values == nullptr)
+	{
+		return;
+	}
+
+	const int32 NumValues = Mode == EVarAccessJobMode::Set ? 1 : Targets.Num();
+	const int32 ValueSize = ValueProperty->GetSize();
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		ValueProperty->DestroyValue(Values + Index * ValueSize);
+	}
+	FMemory::Free(Values);
+}
+
+bool FVarAccessBulkOperation::Step(double BudgetSeconds)
+{
+	if (IsFinished())
+	{
+		return true;
+	}
+
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+	if (ChainsEpoch != Epoch)
+	{
+		Chains.Reset();
+		ChainsEpoch = Epoch;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+	while (NextTargetIndex < Targets.Num())
+	{
+		ProcessTarget(NextTargetIndex++);
+		if (NextTargetIndex % BudgetCheckInterval == 0 && FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+
+	return IsFinished();
+}
+
+void FVarAccessBulkOperation::ProcessTarget(int32 TargetIndex)
+{
+	UObject* Target = Targets[TargetIndex].Get();
+	if (Target == nullptr)
+	{
+		return;
+	}
+
+	const UClass* Class = Target->GetClass();
+	FVarAccessChain* Chain = Chains.Find(Class);
+	if (Chain == nullptr)
+	{
+		Chain = &Chains.Add(Class);
+		Chain->VarDescs = VarDescs;
+		Chain->Links.SetNum(VarDescs.Num());
+	}
+
+	TTuple<FProperty*, void*> Terminal =
+		FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(Chain, Target, ValueProperty, Params);
+	FProperty* TerminalProperty = Terminal.Get<0>();
+	void* TerminalAddr = Terminal.Get<1>();
+	if (TerminalProperty == nullptr || TerminalAddr == nullptr)
+	{
+		return;
+	}
+
+	if (Mode == EVarAccessJobMode::Set)
+	{
+		TerminalProperty->CopyCompleteValue(TerminalAddr, Values);
+	}
+	else
+	{
+		TerminalProperty->CopyCompleteValue(Values + TargetIndex * ValueProperty->GetSize(), TerminalAddr);
+	}
+	Succeeded[TargetIndex] = true;
+	++NumSucceeded;
+}
+
+void FVarAccessBulkOperation::Cancel()
+{
+	bCancelled = true;
+}
+
+bool FVarAccessBulkOperation::IsFinished() const
+{
+	return bCancelled || !bIsValidPath || NextTargetIndex >= Targets.Num();
+}
+
+bool FVarAccessBulkOperation::IsCancelled() const
+{
+	return bCancelled;
+}
+
+float FVarAccessBulkOperation::GetProgress() const
+{
+	if (Targets.Num() == 0 || !bIsValidPath)
+	{
+		return 1.0f;
+	}
+
+	return (float) NextTargetIndex / Targets.Num();
+}
+
+int32 FVarAccessBulkOperation::GetNumSucceeded() const
+{
+	return NumSucceeded;
+}
+
+bool FVarAccessBulkOperation::GetValue(int32 TargetIndex, void* OutValueAddr) const
+{
+	if (Mode != EVarAccessJobMode::Get || !Succeeded.IsValidIndex(TargetIndex) || !Succeeded[TargetIndex])
+	{
+		return false;
+	}
+
+	ValueProperty->CopyCompleteValue(OutValueAddr, Values + TargetIndex * ValueProperty->GetSize());
+
+	return true;
+}
+
+void FVarAccessBulkOperation::CopyValuesToArray(FArrayProperty* ArrayProperty, void* ArrayAddr) const
+{
+	if (Mode != EVarAccessJobMode::Get || Values == nullptr || !ArrayProperty->Inner->SameType(ValueProperty))
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayAddr);
+	ArrayHelper.Resize(Targets.Num());
+	for (int32 Index = 0; Index < Targets.Num(); ++Index)
+	{
+		ArrayProperty->Inner->CopySingleValue(ArrayHelper.GetRawPtr(Index), Values + Index * ValueProperty->GetSize());
+	}
+}
+
+class FVarAccessBulkLatentAction : public FPendingLatentAction
+{
+public:
+	FVarAccessBulkLatentAction(const TSharedRef<FVarAccessBulkOperation>& InOperation, double InBudgetSeconds,
+		FName InOperationName, const FLatentActionInfo& LatentInfo, int32* InNumSucceeded, FArrayProperty* InValuesProperty,
+		void* InValuesAddr)
+		: Operation(InOperation)
+		, BudgetSeconds(InBudgetSeconds)
+		, OperationName(InOperationName)
+		, ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, NumSucceeded(InNumSucceeded)
+		, ValuesProperty(InValuesProperty)
+		, ValuesAddr(InValuesAddr)
+	{
+	}
+
+	virtual ~FVarAccessBulkLatentAction()
+	{
+		ReleaseOperationName();
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		const bool bFinished = Operation->Step(BudgetSeconds);
+		if (bFinished)
+		{
+			// The outputs live in the persistent frame of the event graph.
+			*NumSucceeded = Operation->GetNumSucceeded();
+			if (ValuesProperty != nullptr && ValuesAddr != nullptr)
+			{
+				Operation->CopyValuesToArray(ValuesProperty, ValuesAddr);
+			}
+			ReleaseOperationName();
+		}
+
+		Response.FinishAndTriggerIf(bFinished, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+	virtual void NotifyObjectDestroyed() override
+	{
+		Operation->Cancel();
+	}
+
+	virtual void NotifyActionAborted() override
+	{
+		Operation->Cancel();
+	}
+
+#if WITH_EDITOR
+	virtual FString GetDescription() const override
+	{
+		return FString::Printf(TEXT("Bulk access: %.0f%%"), Operation->GetProgress() * 100.0f);
+	}
+#endif
+
+private:
+	// Forget the name of the finished operation, unless the name is already used by another operation.
+	void ReleaseOperationName()
+	{
+		if (OperationName.IsNone())
+		{
+			return;
+		}
+
+		TWeakPtr<FVarAccessBulkOperation>* Found = NamedBulkOperations.Find(OperationName);
+		if (Found != nullptr && (!Found->IsValid() || Found->HasSameObject(&Operation.Get())))
+		{
+			NamedBulkOperations.Remove(OperationName);
+		}
+		OperationName = NAME_None;
+	}
+
+	TSharedRef<FVarAccessBulkOperation> Operation;
+	double BudgetSeconds;
+	FName OperationName;
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+	int32* NumSucceeded;
+	FArrayProperty* ValuesProperty;
+	void* ValuesAddr;
+};
+
+static void StartBulkLatentAction(UObject* WorldContextObject, const TSharedRef<FVarAccessBulkOperation>& Operation,
+	float BudgetMilliseconds, FName OperationName, const FLatentActionInfo& LatentInfo, int32* NumSucceeded,
+	FArrayProperty* ValuesProperty, void* ValuesAddr)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	if (LatentActionManager.FindExistingAction<FVarAccessBulkLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+	{
+		return;
+	}
+
+	if (!OperationName.IsNone())
+	{
+		NamedBulkOperations.Add(OperationName, Operation);
+	}
+
+	LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID,
+		new FVarAccessBulkLatentAction(
+			Operation, BudgetMilliseconds / 1000.0, OperationName, LatentInfo, NumSucceeded, ValuesProperty, ValuesAddr));
+}
+
+static TArray<TWeakObjectPtr<UObject>> MakeWeakTargets(const TArray<UObject*>& Targets)
+{
+	TArray<TWeakObjectPtr<UObject>> WeakTargets;
+	WeakTargets.Reserve(Targets.Num());
+	for (UObject* Target : Targets)
+	{
+		WeakTargets.Add(Target);
+	}
+
+	return WeakTargets;
+}
+
+void UVariableBulkAccessFunctionLibrary::RunBulkOperation(const TSharedRef<FVarAccessBulkOperation>& Operation,
+	double BudgetSeconds, TFunction<void(FVarAccessBulkOperation&)> OnFinished)
+{
+	auto Tick = [Operation, BudgetSeconds, OnFinished](float DeltaTime)
+	{
+		if (!Operation->Step(BudgetSeconds))
+		{
+			return true;
+		}
+		if (OnFinished)
+		{
+			OnFinished(*Operation);
+		}
+		return false;
+	};
+
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(Tick));
+#else
+	FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(Tick));
+#endif
+}
+
+void UVariableBulkAccessFunctionLibrary::GenericBulkGetNestedVariableByName(UObject* WorldContextObject,
+	const TArray<UObject*>& Targets, FName VarName, const FAccessVariableParams& Params, float BudgetMilliseconds,
+	FName OperationName, FLatentActionInfo LatentInfo, int32* NumSucceeded, FArrayProperty* ValuesProperty, void* ValuesAddr)
+{
+	*NumSucceeded = 0;
+
+	if (ValuesProperty == nullptr || ValuesAddr == nullptr)
+	{
+		return;
+	}
+
+	TSharedRef<FVarAccessBulkOperation> Operation = MakeShared<FVarAccessBulkOperation>(
+		EVarAccessJobMode::Get, MakeWeakTargets(Targets), VarName.ToString(), ValuesProperty->Inner, nullptr, Params);
+	StartBulkLatentAction(
+		WorldContextObject, Operation, BudgetMilliseconds, OperationName, LatentInfo, NumSucceeded, ValuesProperty, ValuesAddr);
+}
+
+void UVariableBulkAccessFunctionLibrary::GenericBulkSetNestedVariableByName(UObject* WorldContextObject,
+	const TArray<UObject*>& Targets, FName VarName, const FAccessVariableParams& Params, float BudgetMilliseconds,
+	FName OperationName, FLatentActionInfo LatentInfo, int32* NumSucceeded, FProperty* NewValueProperty, void* NewValueAddr)
+{
+	*NumSucceeded = 0;
+
+	if (NewValueProperty == nullptr || NewValueAddr == nullptr)
+	{
+		return;
+	}
+
+	TSharedRef<FVarAccessBulkOperation> Operation = MakeShared<FVarAccessBulkOperation>(
+		EVarAccessJobMode::Set, MakeWeakTargets(Targets), VarName.ToString(), NewValueProperty, NewValueAddr, Params);
+	StartBulkLatentAction(
+		WorldContextObject, Operation, BudgetMilliseconds, OperationName, LatentInfo, NumSucceeded, nullptr, nullptr);
+}
+
+void UVariableBulkAccessFunctionLibrary::BulkGetNestedVariableByName(UObject* WorldContextObject,
+	const TArray<UObject*>& Targets, FName VarName, FAccessVariableParams Params, float BudgetMilliseconds, FName OperationName,
+	FLatentActionInfo LatentInfo, int32& NumSucceeded, TArray<int32>& Values)
+{
+	check(0);
+}
+
+void UVariableBulkAccessFunctionLibrary::BulkSetNestedVariableByName(UObject* WorldContextObject,
+	const TArray<UObject*>& Targets, FName VarName, FAccessVariableParams Params, float BudgetMilliseconds, FName OperationName,
+	FLatentActionInfo LatentInfo, int32& NumSucceeded, UProperty* NewValue)
+{
+	check(0);
+}
+
+float UVariableBulkAccessFunctionLibrary::GetBulkOperationProgress(FName OperationName)
+{
+	TWeakPtr<FVarAccessBulkOperation>* Found = NamedBulkOperations.Find(OperationName);
+	if (Found == nullptr)
+	{
+		return -1.0f;
+	}
+
+	TSharedPtr<FVarAccessBulkOperation> Operation = Found->Pin();
+	if (!Operation.IsValid() || Operation->IsFinished())
+	{
+		NamedBulkOperations.Remove(OperationName);
+		return -1.0f;
+	}
+
+	return Operation->GetProgress();
+}
+
+void UVariableBulkAccessFunctionLibrary::CancelBulkOperation(FName OperationName)
+{
+	TWeakPtr<FVarAccessBulkOperation>* Found = NamedBulkOperations.Find(OperationName);
+	if (Found == nullptr)
+	{
+		return;
+	}
+
+	if (TSharedPtr<FVarAccessBulkOperation> Operation = Found->Pin())
+	{
+		Operation->Cancel();
+	}
+	NamedBulkOperations.Remove(OperationName);
+}
@@ -9,35 +9,111 @@
 
 #include "VariableGetterFunctionLibrary.h"
 
+#include "UObject/GarbageCollection.h"
 #include "UObject/TextProperty.h"
 #include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessThreadSafe.h"
 
 void UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
 	UObject* Target, FName VarName, bool& Success, FProperty* ResultProperty, void* ResultAddr, const FAccessVariableParams& Params)
 {
-	TArray<FString> Vars;
-	TArray<FVarDescription> VarDescs;
-	FVariableAccessFunctionLibraryUtils::SplitVarName(VarName.ToString(), &Vars);
-	FVariableAccessFunctionLibraryUtils::AnalyzeVarNames(Vars, &VarDescs);
+	// Convert on the stack, so that a repeated access does not allocate.
+	FNameBuilder VarNameBuilder(VarName);
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindThreadChain(Target, VarNameBuilder.ToView(), Params);
+	if (Chain == nullptr)
+	{
+		return;
+	}
 
-#ifdef AVBN_FREE_VERSION
-	if (VarDescs.Num() >= 2)
+	Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
+		Chain, Target, ResultProperty, ResultAddr, nullptr, nullptr, Params);
+	if (!Success && ResultProperty != nullptr)
 	{
-		UE_LOG(LogTemp, Error,
-			TEXT("Nested property is not supported on the free version. Please consider to buy full version at Fab."));
+		ResultProperty->ClearValue(ResultAddr);
+	}
+}
+
+void UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(const FVarAccessCallSiteKey& CallSite, UObject* Target,
+	FName VarName, const FVarAccessArguments* Arguments, bool& Success, FProperty* ResultProperty, void* ResultAddr,
+	const FAccessVariableParams& Params)
+{
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Target, VarName, Params);
+	if (Chain == nullptr && Arguments == nullptr)
+	{
+		GenericGetNestedVariableByName(Target, VarName, Success, ResultProperty, ResultAddr, Params);
 		return;
 	}
-	if (VarDescs.Num() == 1 && VarDescs[0].ArrayAccessType != ArrayAccessType_None)
+
+	FVarAccessChain UncachedChain;
+	if (Chain == nullptr)
+	{
+		if (!FVariableAccessFunctionLibraryUtils::ParseVarName(VarName.ToString(), &UncachedChain.VarDescs))
+		{
+			return;
+		}
+		Chain = &UncachedChain;
+	}
+
+	Success = false;
+	if (Arguments == nullptr || FVariableAccessFunctionLibraryUtils::ApplyArguments(&Chain->VarDescs, *Arguments))
+	{
+		Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
+			Chain, Target, ResultProperty, ResultAddr, nullptr, nullptr, Params);
+	}
+	if (!Success && ResultProperty != nullptr)
+	{
+		ResultProperty->ClearValue(ResultAddr);
+	}
+}
+
+void UVariableGetterFunctionLibarary::GenericGetNestedVariableByNameThreadSafe(UObject* Target, FName VarName, bool& Success,
+	FProperty* ResultProperty, void* ResultAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	FGCScopeGuard GCGuard;
+	TTuple<FProperty*, void*> Terminal = FVariableAccessThreadSafe::ResolveInlineVariable(Target, VarName, Params);
+	FProperty* TerminalProperty = Terminal.Get<0>();
+	if (TerminalProperty != nullptr && ResultProperty != nullptr && TerminalProperty->SameType(ResultProperty))
+	{
+		ResultProperty->CopyCompleteValue(ResultAddr, Terminal.Get<1>());
+		Success = true;
+	}
+	if (!Success && ResultProperty != nullptr)
+	{
+		ResultProperty->ClearValue(ResultAddr);
+	}
+}
+
+void UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(UObject* Target, FStringView VarName, bool& Success,
+	FProperty* ResultProperty, void* ResultAddr, const FAccessVariableParams& Params)
+{
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindThreadChain(Target, VarName, Params);
+	if (Chain == nullptr)
 	{
-		UE_LOG(LogTemp, Error,
-			TEXT("The access of Array/Map's element is not supported on the free version. "
-				 "Please consider to buy full version at Fab."));
 		return;
 	}
-#endif
 
 	Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
-		VarDescs, 0, Target, ResultProperty, ResultAddr, nullptr, nullptr, Params);
+		Chain, Target, ResultProperty, ResultAddr, nullptr, nullptr, Params);
+	if (!Success && ResultProperty != nullptr)
+	{
+		ResultProperty->ClearValue(ResultAddr);
+	}
+}
+
+void UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(const FVarAccessCallSiteKey& CallSite, UObject* Target,
+	FStringView VarName, bool& Success, FProperty* ResultProperty, void* ResultAddr, const FAccessVariableParams& Params)
+{
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Target, VarName, Params);
+	if (Chain == nullptr)
+	{
+		GenericGetNestedVariableByString(Target, VarName, Success, ResultProperty, ResultAddr, Params);
+		return;
+	}
+
+	Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
+		Chain, Target, ResultProperty, ResultAddr, nullptr, nullptr, Params);
 	if (!Success && ResultProperty != nullptr)
 	{
 		ResultProperty->ClearValue(ResultAddr);
@@ -55,3 +131,35 @@ void UVariableGetterFunctionLibarary::GetNestedVariableByNamePure(
 {
 	check(0);
 }
+
+void UVariableGetterFunctionLibarary::GetNestedVariableByNameThreadSafe(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty*& Result)
+{
+	check(0);
+}
+
+void UVariableGetterFunctionLibarary::GetNestedVariableByNameWithArguments(UObject* Target, FName VarName,
+	const TArray<int32>& IntArguments, const TArray<FName>& NameArguments, FAccessVariableParams Params, bool& Success,
+	UProperty*& Result)
+{
+	check(0);
+}
+
+void UVariableGetterFunctionLibarary::GetNestedVariableByNameWithArgumentsPure(UObject* Target, FName VarName,
+	const TArray<int32>& IntArguments, const TArray<FName>& NameArguments, FAccessVariableParams Params, bool& Success,
+	UProperty*& Result)
+{
+	check(0);
+}
+
+void UVariableGetterFunctionLibarary::GetNestedVariableByString(
+	UObject* Target, const FString& VarName, FAccessVariableParams Params, bool& Success, UProperty*& Result)
+{
+	check(0);
+}
+
+void UVariableGetterFunctionLibarary::GetNestedVariableByStringPure(
+	UObject* Target, const FString& VarName, FAccessVariableParams Params, bool& Success, UProperty*& Result)
+{
+	check(0);
+}
@@ -0,0 +1,340 @@
+﻿/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VariableMapFunctionLibrary.h"
+
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UnrealType.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessThreadSafe.h"
+
+static TTuple<FMapProperty*, void*> FindMapByName(UObject* Target, FName VarName, const FAccessVariableParams& Params)
+{
+	const TTuple<FMapProperty*, void*> NullReturn(nullptr, nullptr);
+
+#ifdef AVBN_FREE_VERSION
+	UE_LOG(LogTemp, Error,
+		TEXT("The operation of Map is not supported on the free version. Please consider to buy full version at Fab."));
+	return NullReturn;
+#else
+	// Convert on the stack, so that a repeated access does not allocate.
+	FNameBuilder VarNameBuilder(VarName);
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindThreadChain(Target, VarNameBuilder.ToView(), Params);
+	if (Chain == nullptr)
+	{
+		return NullReturn;
+	}
+
+	TTuple<FProperty*, void*> Terminal =
+		FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(Chain, Target, nullptr, Params);
+	FMapProperty* MapProperty = CastField<FMapProperty>(Terminal.Get<0>());
+	if (MapProperty == nullptr || Terminal.Get<1>() == nullptr)
+	{
+		return NullReturn;
+	}
+
+	return TTuple<FMapProperty*, void*>(MapProperty, Terminal.Get<1>());
+#endif
+}
+
+bool UVariableMapFunctionLibrary::GenericMapContainsByName(UObject* Target, FName VarName, bool& Success, FProperty* KeyProperty,
+	void* KeyAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	FMapProperty* MapProperty = Map.Get<0>();
+	if (MapProperty == nullptr || KeyProperty == nullptr || KeyAddr == nullptr)
+	{
+		return false;
+	}
+	if (!MapProperty->KeyProp->SameType(KeyProperty))
+	{
+		return false;
+	}
+
+	FScriptMapHelper MapHelper(MapProperty, Map.Get<1>());
+
+	Success = true;
+	return MapHelper.FindMapIndexWithKey(KeyAddr) != INDEX_NONE;
+}
+
+void UVariableMapFunctionLibrary::GenericMapAddByName(UObject* Target, FName VarName, bool& Success, FProperty* KeyProperty,
+	void* KeyAddr, FProperty* ValueProperty, void* ValueAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	FMapProperty* MapProperty = Map.Get<0>();
+	if (MapProperty == nullptr || KeyProperty == nullptr || KeyAddr == nullptr || ValueProperty == nullptr ||
+		ValueAddr == nullptr)
+	{
+		return;
+	}
+	if (!MapProperty->KeyProp->SameType(KeyProperty) || !MapProperty->ValueProp->SameType(ValueProperty))
+	{
+		return;
+	}
+
+	FScriptMapHelper MapHelper(MapProperty, Map.Get<1>());
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	MapHelper.AddPair(KeyAddr, ValueAddr);
+
+	Success = true;
+}
+
+bool UVariableMapFunctionLibrary::GenericMapRemoveByName(UObject* Target, FName VarName, bool& Success, FProperty* KeyProperty,
+	void* KeyAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	FMapProperty* MapProperty = Map.Get<0>();
+	if (MapProperty == nullptr || KeyProperty == nullptr || KeyAddr == nullptr)
+	{
+		return false;
+	}
+	if (!MapProperty->KeyProp->SameType(KeyProperty))
+	{
+		return false;
+	}
+
+	FScriptMapHelper MapHelper(MapProperty, Map.Get<1>());
+
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	Success = true;
+	return MapHelper.RemovePair(KeyAddr);
+}
+
+int32 UVariableMapFunctionLibrary::GenericMapRemoveKeysByName(UObject* Target, FName VarName, bool& Success,
+	FArrayProperty* KeysProperty, void* KeysAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	FMapProperty* MapProperty = Map.Get<0>();
+	if (MapProperty == nullptr || KeysProperty == nullptr || KeysAddr == nullptr)
+	{
+		return 0;
+	}
+	if (!MapProperty->KeyProp->SameType(KeysProperty->Inner))
+	{
+		return 0;
+	}
+
+	FScriptMapHelper MapHelper(MapProperty, Map.Get<1>());
+	FScriptArrayHelper KeysHelper(KeysProperty, KeysAddr);
+
+	// Find all pairs by the hash before removing any pair.
+	// Removing a pair unlinks it from the hash bucket, so the map does not need to be rehashed after the bulk removal.
+	TArray<int32, TInlineAllocator<16>> RemoveIndices;
+	for (int32 Index = 0; Index < KeysHelper.Num(); ++Index)
+	{
+		int32 PairIndex = MapHelper.FindMapIndexWithKey(KeysHelper.GetRawPtr(Index));
+		if (PairIndex != INDEX_NONE)
+		{
+			RemoveIndices.Add(PairIndex);
+		}
+	}
+	// The same key may be given more than once, so the duplicated indices are dropped after sorting.
+	RemoveIndices.Sort();
+	int32 NumUniqueIndices = 0;
+	for (int32 Index = 0; Index < RemoveIndices.Num(); ++Index)
+	{
+		if (NumUniqueIndices == 0 || RemoveIndices[NumUniqueIndices - 1] != RemoveIndices[Index])
+		{
+			RemoveIndices[NumUniqueIndices++] = RemoveIndices[Index];
+		}
+	}
+	RemoveIndices.RemoveAt(NumUniqueIndices, RemoveIndices.Num() - NumUniqueIndices);
+	FWriteScopeLock ContainerLock(FVariableAccessThreadSafe::GetContainerLock());
+	for (int32 PairIndex : RemoveIndices)
+	{
+		MapHelper.RemoveAt(PairIndex);
+	}
+
+	Success = true;
+	return RemoveIndices.Num();
+}
+
+void UVariableMapFunctionLibrary::GenericMapKeysByName(UObject* Target, FName VarName, bool& Success,
+	FArrayProperty* KeysProperty, void* KeysAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	FMapProperty* MapProperty = Map.Get<0>();
+	if (MapProperty == nullptr || KeysProperty == nullptr || KeysAddr == nullptr)
+	{
+		return;
+	}
+	if (!MapProperty->KeyProp->SameType(KeysProperty->Inner))
+	{
+		return;
+	}
+
+	FScriptMapHelper MapHelper(MapProperty, Map.Get<1>());
+	FScriptArrayHelper KeysHelper(KeysProperty, KeysAddr);
+	KeysHelper.EmptyValues(MapHelper.Num());
+	for (int32 PairIndex = 0; PairIndex < MapHelper.GetMaxIndex(); ++PairIndex)
+	{
+		if (!MapHelper.IsValidIndex(PairIndex))
+		{
+			continue;
+		}
+
+		int32 Index = KeysHelper.AddValue();
+		MapProperty->KeyProp->CopySingleValue(KeysHelper.GetRawPtr(Index), MapHelper.GetKeyPtr(PairIndex));
+	}
+
+	Success = true;
+}
+
+void UVariableMapFunctionLibrary::GenericMapValuesByName(UObject* Target, FName VarName, bool& Success,
+	FArrayProperty* ValuesProperty, void* ValuesAddr, const FAccessVariableParams& Params)
+{
+	Success = false;
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	FMapProperty* MapProperty = Map.Get<0>();
+	if (MapProperty == nullptr || ValuesProperty == nullptr || ValuesAddr == nullptr)
+	{
+		return;
+	}
+	if (!MapProperty->ValueProp->SameType(ValuesProperty->Inner))
+	{
+		return;
+	}
+
+	FScriptMapHelper MapHelper(MapProperty, Map.Get<1>());
+	FScriptArrayHelper ValuesHelper(ValuesProperty, ValuesAddr);
+	ValuesHelper.EmptyValues(MapHelper.Num());
+	for (int32 PairIndex = 0; PairIndex < MapHelper.GetMaxIndex(); ++PairIndex)
+	{
+		if (!MapHelper.IsValidIndex(PairIndex))
+		{
+			continue;
+		}
+
+		int32 Index = ValuesHelper.AddValue();
+		MapProperty->ValueProp->CopySingleValue(ValuesHelper.GetRawPtr(Index), MapHelper.GetValuePtr(PairIndex));
+	}
+
+	Success = true;
+}
+
+void UVariableMapFunctionLibrary::GenericMapGetPairByView(const FVarAccessContainerView& View, int32 PairIndex, bool& Success,
+	FProperty* KeyProperty, void* KeyAddr, FProperty* ValueProperty, void* ValueAddr)
+{
+	Success = false;
+
+	// The property of the view is valid only while the view is resolved.
+	void* MapAddr = FVariableAccessFunctionLibraryUtils::ResolveContainerView(View);
+	FMapProperty* MapProperty = MapAddr != nullptr ? CastField<FMapProperty>(View.Property) : nullptr;
+	if (MapProperty != nullptr && KeyProperty != nullptr && KeyAddr != nullptr && ValueProperty != nullptr &&
+		ValueAddr != nullptr && MapProperty->KeyProp->SameType(KeyProperty) && MapProperty->ValueProp->SameType(ValueProperty))
+	{
+		FScriptMapHelper MapHelper(MapProperty, MapAddr);
+		if (MapHelper.IsValidIndex(PairIndex))
+		{
+			MapProperty->KeyProp->CopySingleValue(KeyAddr, MapHelper.GetKeyPtr(PairIndex));
+			MapProperty->ValueProp->CopySingleValue(ValueAddr, MapHelper.GetValuePtr(PairIndex));
+			Success = true;
+		}
+	}
+
+	if (!Success && KeyProperty != nullptr && KeyAddr != nullptr)
+	{
+		KeyProperty->ClearValue(KeyAddr);
+	}
+	if (!Success && ValueProperty != nullptr && ValueAddr != nullptr)
+	{
+		ValueProperty->ClearValue(ValueAddr);
+	}
+}
+
+int32 UVariableMapFunctionLibrary::MapViewByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, FVarAccessContainerView& View)
+{
+	Success = false;
+	View = FVarAccessContainerView();
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	if (Map.Get<0>() == nullptr)
+	{
+		return 0;
+	}
+
+	View = FVariableAccessFunctionLibraryUtils::MakeContainerView(Target, VarName, Params, Map.Get<0>(), Map.Get<1>());
+	FScriptMapHelper MapHelper(Map.Get<0>(), Map.Get<1>());
+
+	Success = true;
+	return MapHelper.GetMaxIndex();
+}
+
+void UVariableMapFunctionLibrary::MapGetPairByView(
+	const FVarAccessContainerView& View, int32 PairIndex, bool& Success, UProperty*& Key, UProperty*& Value)
+{
+	check(0);
+}
+
+bool UVariableMapFunctionLibrary::MapContainsByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* Key)
+{
+	check(0);
+	return false;
+}
+
+void UVariableMapFunctionLibrary::MapAddByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* Key, UProperty* Value)
+{
+	check(0);
+}
+
+bool UVariableMapFunctionLibrary::MapRemoveByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* Key)
+{
+	check(0);
+	return false;
+}
+
+int32 UVariableMapFunctionLibrary::MapRemoveKeysByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, const TArray<int32>& Keys)
+{
+	check(0);
+	return 0;
+}
+
+void UVariableMapFunctionLibrary::MapKeysByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, TArray<int32>& Keys)
+{
+	check(0);
+}
+
+void UVariableMapFunctionLibrary::MapValuesByName(
+	UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, TArray<int32>& Values)
+{
+	check(0);
+}
+
+int32 UVariableMapFunctionLibrary::MapNumByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success)
+{
+	Success = false;
+
+	TTuple<FMapProperty*, void*> Map = FindMapByName(Target, VarName, Params);
+	if (Map.Get<0>() == nullptr)
+	{
+		return 0;
+	}
+
+	FScriptMapHelper MapHelper(Map.Get<0>(), Map.Get<1>());
+
+	Success = true;
+	return MapHelper.Num();
+}
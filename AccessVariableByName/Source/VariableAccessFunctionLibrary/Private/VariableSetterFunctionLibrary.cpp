@@ -19,29 +19,101 @@ void UVariableSetterFunctionLibarary::GenericSetNestedVariableByName(UObject* Ta
 	FProperty* ResultProperty, void* ResultAddr, FProperty* NewValueProperty, void* NewValueAddr,
 	const FAccessVariableParams& Params)
 {
-	TArray<FString> Vars;
-	TArray<FVarDescription> VarDescs;
-	FVariableAccessFunctionLibraryUtils::SplitVarName(VarName.ToString(), &Vars);
-	FVariableAccessFunctionLibraryUtils::AnalyzeVarNames(Vars, &VarDescs);
+	// Convert on the stack, so that a repeated access does not allocate.
+	FNameBuilder VarNameBuilder(VarName);
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindThreadChain(Target, VarNameBuilder.ToView(), Params);
+	if (Chain == nullptr)
+	{
+		return;
+	}
+
+	Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
+		Chain, Target, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+	if (!Success && ResultProperty != nullptr)
+	{
+		ResultProperty->ClearValue(ResultAddr);
+	}
+}
+
+void UVariableSetterFunctionLibarary::SetNestedVariableByNameWithArguments(UObject* Target, FName VarName,
+	const TArray<int32>& IntArguments, const TArray<FName>& NameArguments, FAccessVariableParams Params, bool& Success,
+	UProperty*& Result, UProperty* NewValue)
+{
+	check(0);
+}
+
+void UVariableSetterFunctionLibarary::GenericSetNestedVariableByName(const FVarAccessCallSiteKey& CallSite, UObject* Target,
+	FName VarName, const FVarAccessArguments* Arguments, bool& Success, FProperty* ResultProperty, void* ResultAddr,
+	FProperty* NewValueProperty, void* NewValueAddr, const FAccessVariableParams& Params)
+{
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Target, VarName, Params);
+	if (Chain == nullptr && Arguments == nullptr)
+	{
+		GenericSetNestedVariableByName(
+			Target, VarName, Success, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+		return;
+	}
+
+	FVarAccessChain UncachedChain;
+	if (Chain == nullptr)
+	{
+		if (!FVariableAccessFunctionLibraryUtils::ParseVarName(VarName.ToString(), &UncachedChain.VarDescs))
+		{
+			return;
+		}
+		Chain = &UncachedChain;
+	}
+
+	Success = false;
+	if (Arguments == nullptr || FVariableAccessFunctionLibraryUtils::ApplyArguments(&Chain->VarDescs, *Arguments))
+	{
+		Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
+			Chain, Target, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+	}
+	if (!Success && ResultProperty != nullptr)
+	{
+		ResultProperty->ClearValue(ResultAddr);
+	}
+}
+
+void UVariableSetterFunctionLibarary::SetNestedVariableByString(UObject* Target, const FString& VarName,
+	FAccessVariableParams Params, bool& Success, UProperty*& Result, UProperty* NewValue)
+{
+	check(0);
+}
 
-#ifdef AVBN_FREE_VERSION
-	if (VarDescs.Num() >= 2)
+void UVariableSetterFunctionLibarary::GenericSetNestedVariableByString(UObject* Target, FStringView VarName, bool& Success,
+	FProperty* ResultProperty, void* ResultAddr, FProperty* NewValueProperty, void* NewValueAddr,
+	const FAccessVariableParams& Params)
+{
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindThreadChain(Target, VarName, Params);
+	if (Chain == nullptr)
 	{
-		UE_LOG(LogTemp, Error,
-			TEXT("Nested property is not supported on the free version. Please consider to buy full version at Fab."));
 		return;
 	}
-	if (VarDescs.Num() == 1 && VarDescs[0].ArrayAccessType != ArrayAccessType_None)
+
+	Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
+		Chain, Target, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+	if (!Success && ResultProperty != nullptr)
+	{
+		ResultProperty->ClearValue(ResultAddr);
+	}
+}
+
+void UVariableSetterFunctionLibarary::GenericSetNestedVariableByString(const FVarAccessCallSiteKey& CallSite, UObject* Target,
+	FStringView VarName, bool& Success, FProperty* ResultProperty, void* ResultAddr, FProperty* NewValueProperty,
+	void* NewValueAddr, const FAccessVariableParams& Params)
+{
+	FVarAccessChain* Chain = FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Target, VarName, Params);
+	if (Chain == nullptr)
 	{
-		UE_LOG(LogTemp, Error,
-			TEXT("The access of Array/Map's element is not supported on the free version. "
-				 "Please consider to buy full version at Fab."));
+		GenericSetNestedVariableByString(
+			Target, VarName, Success, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
 		return;
 	}
-#endif
 
 	Success = FVariableAccessFunctionLibraryUtils::HandleTerminalProperty(
-		VarDescs, 0, Target, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+		Chain, Target, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
 	if (!Success && ResultProperty != nullptr)
 	{
 		ResultProperty->ClearValue(ResultAddr);
@@ -0,0 +1,323 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Parser of the variable path (e.g. "Inventory.Items[0].Tags[\"Rare\"]").
+// It does not depend on the engine, so that it is also built as a plain C++ library (see tests/path_core).
+// The grammar is written as constexpr functions, which are shared by the parser at runtime and at compile time.
+namespace VarAccessPath
+{
+enum class EIndexType : uint8_t
+{
+	None,
+	Integer,
+	String,
+};
+
+// One member access of the path.
+template <typename CharType>
+struct TSegment
+{
+	bool bIsValid = false;
+	std::basic_string<CharType> Name;
+	EIndexType IndexType = EIndexType::None;
+	// Index of "Name[0]", or -1.
+	int32_t Integer = -1;
+	// Key of "Name[\"Key\"]".
+	std::basic_string<CharType> String;
+	// Index of the argument of "Name[{0}]" or "Name[\"{0}\"]", or -1.
+	int32_t ArgumentIndex = -1;
+};
+
+// Same as TSegment, but refers to the characters of the path instead of owning them.
+template <typename CharType>
+struct TSegmentView
+{
+	bool bIsValid = false;
+	const CharType* Name = nullptr;
+	size_t NameLength = 0;
+	EIndexType IndexType = EIndexType::None;
+	int32_t Integer = -1;
+	const CharType* String = nullptr;
+	size_t StringLength = 0;
+	int32_t ArgumentIndex = -1;
+};
+
+// Range of a segment in the path.
+struct FToken
+{
+	size_t Offset = 0;
+	size_t Length = 0;
+};
+
+namespace Detail
+{
+template <typename CharType>
+constexpr uint32_t ToCodeUnit(CharType Ch)
+{
+	return static_cast<uint32_t>(static_cast<typename std::make_unsigned<CharType>::type>(Ch));
+}
+
+template <typename CharType>
+constexpr bool IsNameHead(CharType Ch)
+{
+	return (ToCodeUnit(Ch) >= 'a' && ToCodeUnit(Ch) <= 'z') || (ToCodeUnit(Ch) >= 'A' && ToCodeUnit(Ch) <= 'Z') ||
+		   ToCodeUnit(Ch) == '_';
+}
+
+template <typename CharType>
+constexpr bool IsDigit(CharType Ch)
+{
+	return ToCodeUnit(Ch) >= '0' && ToCodeUnit(Ch) <= '9';
+}
+
+template <typename CharType>
+constexpr bool IsNameTail(CharType Ch)
+{
+	return IsNameHead(Ch) || IsDigit(Ch) || ToCodeUnit(Ch) == ' ';
+}
+
+// White space of Unicode, which the key of "Name[\"Key\"]" must not contain.
+template <typename CharType>
+constexpr bool IsSpace(CharType Ch)
+{
+	const uint32_t Code = ToCodeUnit(Ch);
+	if ((Code >= 0x09 && Code <= 0x0D) || Code == 0x20 || Code == 0x85 || Code == 0xA0)
+	{
+		// The code units over 0x7F of a narrow string are a part of UTF-8 sequences.
+		return Code <= 0x7F || sizeof(CharType) > 1;
+	}
+	if (sizeof(CharType) == 1)
+	{
+		return false;
+	}
+
+	return Code == 0x1680 || (Code >= 0x2000 && Code <= 0x200A) || Code == 0x2028 || Code == 0x2029 || Code == 0x202F ||
+		   Code == 0x205F || Code == 0x3000;
+}
+
+// Parse the digits. The value is clamped to the maximum of int32_t.
+template <typename CharType>
+constexpr int32_t ParseDigits(const CharType* Text, size_t Length)
+{
+	int64_t Value = 0;
+	for (size_t Index = 0; Index < Length; ++Index)
+	{
+		Value = Value * 10 + (ToCodeUnit(Text[Index]) - '0');
+		if (Value > std::numeric_limits<int32_t>::max())
+		{
+			return std::numeric_limits<int32_t>::max();
+		}
+	}
+
+	return static_cast<int32_t>(Value);
+}
+
+template <typename CharType>
+constexpr bool AreDigits(const CharType* Text, size_t Length)
+{
+	if (Length == 0)
+	{
+		return false;
+	}
+	for (size_t Index = 0; Index < Length; ++Index)
+	{
+		if (!IsDigit(Text[Index]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Length of the name at the head of the segment, or 0 if the segment does not start with a name.
+template <typename CharType>
+constexpr size_t ScanName(const CharType* Segment, size_t Length)
+{
+	if (Length == 0 || !IsNameHead(Segment[0]))
+	{
+		return 0;
+	}
+
+	size_t NameLength = 1;
+	while (NameLength < Length && IsNameTail(Segment[NameLength]))
+	{
+		++NameLength;
+	}
+
+	return NameLength;
+}
+}	 // namespace Detail
+
+// Index of the argument placeholder (e.g. "{0}"), or -1.
+template <typename CharType>
+constexpr int32_t ParseArgumentIndex(const CharType* Text, size_t Length)
+{
+	if (Length < 3 || Detail::ToCodeUnit(Text[0]) != '{' || Detail::ToCodeUnit(Text[Length - 1]) != '}' ||
+		!Detail::AreDigits(Text + 1, Length - 2))
+	{
+		return -1;
+	}
+
+	return Detail::ParseDigits(Text + 1, Length - 2);
+}
+
+// FNV-1a over the code units.
+template <typename CharType>
+constexpr uint32_t HashPath(const CharType* Path, size_t Length)
+{
+	uint32_t Hash = 2166136261u;
+	for (size_t Index = 0; Index < Length; ++Index)
+	{
+		Hash = (Hash ^ Detail::ToCodeUnit(Path[Index])) * 16777619u;
+	}
+
+	return Hash;
+}
+
+// First segment which begins at Start or later. The dots inside the double quotes do not split the path.
+// Length of the token is 0 if no segment is left. The next segment begins at Offset + Length + 1.
+template <typename CharType>
+constexpr FToken NextToken(const CharType* Path, size_t Length, size_t Start)
+{
+	FToken Token;
+	bool bInString = false;
+	size_t Begin = Start;
+	for (size_t Index = Start; Index <= Length; ++Index)
+	{
+		if (Index < Length)
+		{
+			const uint32_t Code = Detail::ToCodeUnit(Path[Index]);
+			if (Code == '"')
+			{
+				bInString = !bInString;
+			}
+			if (bInString || Code != '.')
+			{
+				continue;
+			}
+		}
+
+		if (Index > Begin)
+		{
+			Token.Offset = Begin;
+			Token.Length = Index - Begin;
+			return Token;
+		}
+		Begin = Index + 1;
+	}
+
+	Token.Offset = Length;
+	return Token;
+}
+
+// Segment is one of "Name", "Name[0]", "Name[{0}]" and "Name[\"Key\"]".
+// Name starts with [a-zA-Z_] followed by [a-zA-Z0-9_ ], and Key is one or more non-space characters.
+template <typename CharType>
+constexpr TSegmentView<CharType> ScanSegment(const CharType* Segment, size_t Length)
+{
+	TSegmentView<CharType> Result;
+
+	const size_t NameLength = Detail::ScanName(Segment, Length);
+	if (NameLength == 0)
+	{
+		return Result;
+	}
+	Result.Name = Segment;
+	Result.NameLength = NameLength;
+
+	// Name pattern.
+	if (NameLength == Length)
+	{
+		Result.bIsValid = true;
+		return Result;
+	}
+
+	const CharType* Index = Segment + NameLength;
+	const size_t IndexLength = Length - NameLength;
+	if (Detail::ToCodeUnit(Index[0]) != '[' || Detail::ToCodeUnit(Index[IndexLength - 1]) != ']')
+	{
+		return Result;
+	}
+
+	// String pattern.
+	if (IndexLength >= 5 && Detail::ToCodeUnit(Index[1]) == '"' && Detail::ToCodeUnit(Index[IndexLength - 2]) == '"')
+	{
+		const CharType* Key = Index + 2;
+		const size_t KeyLength = IndexLength - 4;
+		bool bHasSpace = false;
+		for (size_t KeyIndex = 0; KeyIndex < KeyLength; ++KeyIndex)
+		{
+			bHasSpace = bHasSpace || Detail::IsSpace(Key[KeyIndex]);
+		}
+		if (!bHasSpace)
+		{
+			Result.bIsValid = true;
+			Result.IndexType = EIndexType::String;
+			Result.String = Key;
+			Result.StringLength = KeyLength;
+			Result.ArgumentIndex = ParseArgumentIndex(Key, KeyLength);
+			return Result;
+		}
+	}
+
+	// Integer argument pattern.
+	if (IndexLength >= 5 && Detail::ToCodeUnit(Index[1]) == '{' && Detail::ToCodeUnit(Index[IndexLength - 2]) == '}' &&
+		Detail::AreDigits(Index + 2, IndexLength - 4))
+	{
+		Result.bIsValid = true;
+		Result.IndexType = EIndexType::Integer;
+		Result.ArgumentIndex = Detail::ParseDigits(Index + 2, IndexLength - 4);
+		return Result;
+	}
+
+	// Integer pattern.
+	if (Detail::AreDigits(Index + 1, IndexLength - 2))
+	{
+		Result.bIsValid = true;
+		Result.IndexType = EIndexType::Integer;
+		Result.Integer = Detail::ParseDigits(Index + 1, IndexLength - 2);
+		return Result;
+	}
+
+	return Result;
+}
+
+// Split the path on the dots outside the double quotes. Empty segments are skipped.
+template <typename CharType>
+void Tokenize(const CharType* Path, size_t Length, std::vector<FToken>* OutTokens);
+
+template <typename CharType>
+TSegment<CharType> ParseSegment(const CharType* Segment, size_t Length);
+
+template <typename CharType>
+void Parse(const CharType* Path, size_t Length, std::vector<TSegment<CharType>>* OutSegments);
+
+// Instantiated in VarAccessPath.cpp for the character types of the engine (TCHAR) and the standalone build.
+extern template void Tokenize<char>(const char*, size_t, std::vector<FToken>*);
+extern template TSegment<char> ParseSegment<char>(const char*, size_t);
+extern template void Parse<char>(const char*, size_t, std::vector<TSegment<char>>*);
+
+extern template void Tokenize<wchar_t>(const wchar_t*, size_t, std::vector<FToken>*);
+extern template TSegment<wchar_t> ParseSegment<wchar_t>(const wchar_t*, size_t);
+extern template void Parse<wchar_t>(const wchar_t*, size_t, std::vector<TSegment<wchar_t>>*);
+
+extern template void Tokenize<char16_t>(const char16_t*, size_t, std::vector<FToken>*);
+extern template TSegment<char16_t> ParseSegment<char16_t>(const char16_t*, size_t);
+extern template void Parse<char16_t>(const char16_t*, size_t, std::vector<TSegment<char16_t>>*);
+}	 // namespace VarAccessPath
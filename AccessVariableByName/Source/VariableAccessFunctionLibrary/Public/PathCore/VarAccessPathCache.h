@@ -0,0 +1,252 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "VarAccessPath.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace VarAccessPath
+{
+// Counters of the parse cache. The hits on the per-thread cache of each thread are added in batches.
+struct FCacheStats
+{
+	uint64_t L1Hits = 0;
+	uint64_t SharedHits = 0;
+	uint64_t Misses = 0;
+	// Lookups which waited for the lock held by another thread.
+	uint64_t ContendedLocks = 0;
+};
+
+// Cache of the values built from the paths (e.g. the parsed segments), which is shared among threads.
+// The cache is split by the hash of the path, so that threads which look up different paths rarely wait for each other.
+// Each thread also remembers the recently found entries without locking.
+// The cache must outlive the threads which use it, since the hits of each thread are added on its exit.
+template <typename CharType, typename ValueType>
+class TParseCache
+{
+public:
+	struct FEntry
+	{
+		uint32_t Hash = 0;
+		std::basic_string<CharType> Path;
+		ValueType Value;
+
+		bool Matches(uint32_t InHash, const CharType* InPath, size_t Length) const
+		{
+			return Hash == InHash && Path.size() == Length && std::char_traits<CharType>::compare(Path.data(), InPath, Length) == 0;
+		}
+	};
+
+	using FEntryPtr = std::shared_ptr<const FEntry>;
+
+	static const size_t NumShards = 32;
+	static const size_t NumL1Slots = 64;
+	// Hits on the per-thread cache are added to the shared counter in batches, so that counting does not contend.
+	static const uint64_t L1HitsBatch = 256;
+
+	// Entries are kept up to MaxEntries, so that generated paths can not grow the cache unboundedly.
+	explicit TParseCache(size_t MaxEntries = 4096) : MaxEntriesPerShard(MaxEntries / NumShards > 0 ? MaxEntries / NumShards : 1)
+	{
+	}
+
+	TParseCache(const TParseCache&) = delete;
+	TParseCache& operator=(const TParseCache&) = delete;
+
+	// Find the entry of the path, or build its value by Build(Path, Length, ValueType& OutValue) and add it.
+	// The returned reference is valid until the next lookup on the same thread.
+	template <typename BuildFunction>
+	const FEntryPtr& FindOrAdd(const CharType* Path, size_t Length, uint32_t Hash, BuildFunction&& Build)
+	{
+		FThreadCache& L1 = GetThreadCache();
+		FL1Slot& L1Slot = L1.Slots[Hash % NumL1Slots];
+		if (L1Slot.Owner == this && L1Slot.Entry && L1Slot.Entry->Matches(Hash, Path, Length))
+		{
+			L1.AddHit(this);
+			return L1Slot.Entry;
+		}
+
+		FShard& Shard = Shards[Hash % NumShards];
+		LockShared(Shard);
+		FEntryPtr Entry = FindInShard(Shard, Hash, Path, Length);
+		Shard.Mutex.unlock_shared();
+		if (Entry)
+		{
+			++SharedHits;
+			L1Slot.Owner = this;
+			L1Slot.Entry = std::move(Entry);
+			return L1Slot.Entry;
+		}
+
+		++Misses;
+		std::shared_ptr<FEntry> NewEntry = std::make_shared<FEntry>();
+		NewEntry->Hash = Hash;
+		NewEntry->Path.assign(Path, Length);
+		Build(Path, Length, NewEntry->Value);
+
+		Lock(Shard);
+		// Another thread may have added the same path while this thread is building.
+		if (!FindInShard(Shard, Hash, Path, Length))
+		{
+			if (Shard.NumEntries >= MaxEntriesPerShard)
+			{
+				Shard.Entries.clear();
+				Shard.NumEntries = 0;
+			}
+			Shard.Entries.emplace(Hash, NewEntry);
+			++Shard.NumEntries;
+		}
+		Shard.Mutex.unlock();
+
+		L1Slot.Owner = this;
+		L1Slot.Entry = std::move(NewEntry);
+		return L1Slot.Entry;
+	}
+
+	template <typename BuildFunction>
+	const FEntryPtr& FindOrAdd(const CharType* Path, size_t Length, BuildFunction&& Build)
+	{
+		return FindOrAdd(Path, Length, HashPath(Path, Length), std::forward<BuildFunction>(Build));
+	}
+
+	// Remove the shared entries. The entries remembered by the threads are still found until they are replaced.
+	void Reset()
+	{
+		for (FShard& Shard : Shards)
+		{
+			Lock(Shard);
+			Shard.Entries.clear();
+			Shard.NumEntries = 0;
+			Shard.Mutex.unlock();
+		}
+	}
+
+	FCacheStats GetStats() const
+	{
+		FCacheStats Stats;
+
+		Stats.L1Hits = L1Hits.load();
+		Stats.SharedHits = SharedHits.load();
+		Stats.Misses = Misses.load();
+		Stats.ContendedLocks = ContendedLocks.load();
+
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		L1Hits = 0;
+		SharedHits = 0;
+		Misses = 0;
+		ContendedLocks = 0;
+	}
+
+private:
+	struct alignas(64) FShard
+	{
+		std::shared_timed_mutex Mutex;
+		std::unordered_multimap<uint32_t, FEntryPtr> Entries;
+		size_t NumEntries = 0;
+	};
+
+	struct FL1Slot
+	{
+		const TParseCache* Owner = nullptr;
+		FEntryPtr Entry;
+	};
+
+	struct FThreadCache
+	{
+		FL1Slot Slots[NumL1Slots];
+		TParseCache* PendingOwner = nullptr;
+		uint64_t PendingHits = 0;
+
+		void AddHit(TParseCache* Owner)
+		{
+			if (PendingOwner != Owner)
+			{
+				Flush();
+				PendingOwner = Owner;
+			}
+			if (++PendingHits >= L1HitsBatch)
+			{
+				Flush();
+			}
+		}
+
+		void Flush()
+		{
+			if (PendingOwner != nullptr)
+			{
+				PendingOwner->L1Hits += PendingHits;
+			}
+			PendingHits = 0;
+		}
+
+		~FThreadCache()
+		{
+			Flush();
+		}
+	};
+
+	static FThreadCache& GetThreadCache()
+	{
+		static thread_local FThreadCache ThreadCache;
+		return ThreadCache;
+	}
+
+	static FEntryPtr FindInShard(const FShard& Shard, uint32_t Hash, const CharType* Path, size_t Length)
+	{
+		auto Range = Shard.Entries.equal_range(Hash);
+		for (auto It = Range.first; It != Range.second; ++It)
+		{
+			if (It->second->Matches(Hash, Path, Length))
+			{
+				return It->second;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void LockShared(FShard& Shard)
+	{
+		if (!Shard.Mutex.try_lock_shared())
+		{
+			++ContendedLocks;
+			Shard.Mutex.lock_shared();
+		}
+	}
+
+	void Lock(FShard& Shard)
+	{
+		if (!Shard.Mutex.try_lock())
+		{
+			++ContendedLocks;
+			Shard.Mutex.lock();
+		}
+	}
+
+	FShard Shards[NumShards];
+	const size_t MaxEntriesPerShard;
+
+	std::atomic<uint64_t> L1Hits{0};
+	std::atomic<uint64_t> SharedHits{0};
+	std::atomic<uint64_t> Misses{0};
+	std::atomic<uint64_t> ContendedLocks{0};
+};
+}	 // namespace VarAccessPath
@@ -0,0 +1,77 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "VarAccessPath.h"
+
+// Parse a literal path at compile time. The build fails if the path is malformed.
+// Initialize a constexpr variable with it, so that the path is always parsed by the compiler.
+//   static constexpr auto HealthPath = VAR_ACCESS_STATIC_PATH(TEXT("Stats.Health"));
+#define VAR_ACCESS_STATIC_PATH(Literal) VarAccessPath::ParseStaticPath<VarAccessPath::CountSegments(Literal)>(Literal)
+
+namespace VarAccessPath
+{
+// Segments of a literal path. The segments refer to the characters of the literal.
+template <typename CharType, size_t MaxSegments>
+struct TStaticPath
+{
+	TSegmentView<CharType> Segments[MaxSegments > 0 ? MaxSegments : 1] = {};
+	size_t NumSegments = 0;
+	// Hash of the whole path, which is same as HashPath at runtime.
+	uint32_t Hash = 0;
+	bool bIsValid = false;
+};
+
+template <typename CharType>
+constexpr size_t CountSegments(const CharType* Path, size_t Length)
+{
+	size_t NumSegments = 0;
+	for (FToken Token = NextToken(Path, Length, 0); Token.Length > 0;
+		 Token = NextToken(Path, Length, Token.Offset + Token.Length + 1))
+	{
+		++NumSegments;
+	}
+
+	return NumSegments;
+}
+
+template <typename CharType, size_t N>
+constexpr size_t CountSegments(const CharType (&Literal)[N])
+{
+	return CountSegments(Literal, N - 1);
+}
+
+// Not constexpr, so that reaching it in the constant evaluation fails the build.
+inline void MalformedVarAccessPath()
+{
+}
+
+template <size_t MaxSegments, typename CharType, size_t N>
+constexpr TStaticPath<CharType, MaxSegments> ParseStaticPath(const CharType (&Literal)[N])
+{
+	TStaticPath<CharType, MaxSegments> Result;
+	Result.bIsValid = MaxSegments > 0;
+	for (FToken Token = NextToken(Literal, N - 1, 0); Token.Length > 0 && Result.NumSegments < MaxSegments;
+		 Token = NextToken(Literal, N - 1, Token.Offset + Token.Length + 1))
+	{
+		Result.Segments[Result.NumSegments] = ScanSegment(Literal + Token.Offset, Token.Length);
+		Result.bIsValid = Result.bIsValid && Result.Segments[Result.NumSegments].bIsValid;
+		++Result.NumSegments;
+	}
+	Result.Hash = HashPath(Literal, N - 1);
+
+	if (!Result.bIsValid)
+	{
+		MalformedVarAccessPath();
+	}
+
+	return Result;
+}
+}	 // namespace VarAccessPath
@@ -0,0 +1,124 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Misc/EngineVersionComparison.h"
+
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+
+#include "Async/Async.h"
+#include "Misc/Optional.h"
+#include "Tasks/Task.h"
+#include "UObject/GarbageCollection.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessTypeTraits.h"
+
+// Access variables from tasks.
+// Reads of the plain data reached only through structure members run on a worker thread, and the other accesses run on
+// the game thread. Waiting on the game thread for the task which runs there is avoided by running it immediately.
+namespace FVariableAccessAsync
+{
+// Return true if the variable can be read outside the game thread.
+// The path must not go through other objects or containers, and the variable must be plain data.
+VARIABLEACCESSFUNCTIONLIBRARY_API bool IsThreadSafeRead(UObject* Target, FName VarName, const FAccessVariableParams& Params);
+VARIABLEACCESSFUNCTIONLIBRARY_API TTuple<FProperty*, void*> ResolveVariable(
+	UObject* Target, FName VarName, const FAccessVariableParams& Params);
+
+template <typename T>
+TOptional<T> ReadVariable(UObject* Target, FName VarName, const FAccessVariableParams& Params)
+{
+	TTuple<FProperty*, void*> Terminal = ResolveVariable(Target, VarName, Params);
+	FProperty* Property = Terminal.Get<0>();
+	if (Property == nullptr || !TVarAccessValueTraits<T>::IsCompatible(Property))
+	{
+		return TOptional<T>();
+	}
+
+	T Value;
+	if (!TVarAccessValueTraits<T>::Read(Property, Terminal.Get<1>(), &Value))
+	{
+		return TOptional<T>();
+	}
+
+	return TOptional<T>(MoveTemp(Value));
+}
+
+template <typename T>
+TOptional<T> WriteVariable(UObject* Target, FName VarName, const T& NewValue, const FAccessVariableParams& Params)
+{
+	TTuple<FProperty*, void*> Terminal = ResolveVariable(Target, VarName, Params);
+	FProperty* Property = Terminal.Get<0>();
+	if (Property == nullptr || !TVarAccessValueTraits<T>::IsCompatible(Property))
+	{
+		return TOptional<T>();
+	}
+	if (!TVarAccessValueTraits<T>::Write(Property, Terminal.Get<1>(), NewValue))
+	{
+		return TOptional<T>();
+	}
+
+	return ReadVariable<T>(Target, VarName, Params);
+}
+
+template <typename ResultType, typename FunctionType>
+UE::Tasks::TTask<ResultType> LaunchOnGameThread(const TCHAR* DebugName, FunctionType&& Function)
+{
+	if (IsInGameThread())
+	{
+		return UE::Tasks::Launch(DebugName, [Result = Function()]() { return Result; });
+	}
+
+	TSharedRef<ResultType, ESPMode::ThreadSafe> Result = MakeShared<ResultType, ESPMode::ThreadSafe>();
+	UE::Tasks::FTaskEvent Event(DebugName);
+	AsyncTask(ENamedThreads::GameThread,
+		[Result, Event, Function = Forward<FunctionType>(Function)]() mutable
+		{
+			*Result = Function();
+			Event.Trigger();
+		});
+
+	return UE::Tasks::Launch(DebugName, [Result]() { return *Result; }, UE::Tasks::Prerequisites(Event));
+}
+
+// Get the variable. The result is unset if the variable is not found or its type is not T.
+template <typename T>
+UE::Tasks::TTask<TOptional<T>> GetNestedVariableByName(
+	UObject* Target, FName VarName, const FAccessVariableParams& Params = FAccessVariableParams())
+{
+	TWeakObjectPtr<UObject> WeakTarget(Target);
+	if (IsThreadSafeRead(Target, VarName, Params))
+	{
+		return UE::Tasks::Launch(TEXT("GetNestedVariableByName"),
+			[WeakTarget, VarName, Params]()
+			{
+				// Keep the target alive while reading it.
+				FGCScopeGuard GCGuard;
+				return ReadVariable<T>(WeakTarget.Get(), VarName, Params);
+			});
+	}
+
+	return LaunchOnGameThread<TOptional<T>>(TEXT("GetNestedVariableByName"),
+		[WeakTarget, VarName, Params]() { return ReadVariable<T>(WeakTarget.Get(), VarName, Params); });
+}
+
+// Set the variable on the game thread. The result is the value after set, or unset if the variable is not set.
+template <typename T>
+UE::Tasks::TTask<TOptional<T>> SetNestedVariableByName(
+	UObject* Target, FName VarName, T NewValue, const FAccessVariableParams& Params = FAccessVariableParams())
+{
+	TWeakObjectPtr<UObject> WeakTarget(Target);
+
+	return LaunchOnGameThread<TOptional<T>>(TEXT("SetNestedVariableByName"),
+		[WeakTarget, VarName, NewValue = MoveTemp(NewValue), Params]()
+		{ return WriteVariable<T>(WeakTarget.Get(), VarName, NewValue, Params); });
+}
+}	 // namespace FVariableAccessAsync
+
+#endif
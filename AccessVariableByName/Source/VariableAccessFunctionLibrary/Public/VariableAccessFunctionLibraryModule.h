@@ -19,6 +19,10 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 	virtual bool SupportsDynamicReloading() override;
+
+private:
+	FDelegateHandle PostGarbageCollectHandle;
+	FDelegateHandle ReloadCompleteHandle;
 };
 
 #undef LOCTEXT_NAMESPACE
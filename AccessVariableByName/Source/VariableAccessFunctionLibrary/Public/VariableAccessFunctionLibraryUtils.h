@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include "Containers/StringView.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "PathCore/VarAccessPath.h"
 
 #include "VariableAccessFunctionLibraryUtils.generated.h"
 
@@ -30,8 +32,90 @@ struct FVarDescription
 {
 	bool bIsValid = false;
 	FString VarName;
+	// VarName as FName, which finds the property without converting the string.
+	FName Name;
 	EArrayAccessType ArrayAccessType;
 	FArrayAccessValue ArrayAccessValue;
+	// Index of the argument substituted into the access value (e.g. "Slots[{0}]"), or INDEX_NONE.
+	int32 ArgumentIndex = INDEX_NONE;
+};
+
+// Values substituted into the placeholders of the variable path.
+struct FVarAccessArguments
+{
+	TArrayView<const int32> Integers;
+	TArrayView<const FName> Names;
+};
+
+// Property resolved at a depth of the variable path on the previous access, and the struct which owns it.
+// Property is nullptr if the owner does not have the variable.
+struct FVarAccessLink
+{
+	const UStruct* Owner = nullptr;
+	FProperty* Property = nullptr;
+	bool bGenerationClass = false;
+};
+
+// Object reached through an object property on the previous access, and the slot in its parent which referred to it.
+struct FVarAccessObjectHop
+{
+	FObjectProperty* Property = nullptr;
+	void* ValueAddr = nullptr;
+	TWeakObjectPtr<UObject> Object;
+	// Depth of the variable path which is resolved on the object.
+	int32 VarDepth = 0;
+};
+
+// Intermediate objects of the variable path resolved from a target.
+struct FVarAccessObjectChain
+{
+	TWeakObjectPtr<UObject> Target;
+	TArray<FVarAccessObjectHop> Hops;
+};
+
+struct FVarAccessNativeBinding;
+
+// Parsed variable path and the properties resolved along it.
+struct FVarAccessChain
+{
+	TArray<FVarDescription> VarDescs;
+	TArray<FVarAccessLink> Links;
+	TArray<FVarAccessObjectChain> ObjectChains;
+	int32 NextObjectChain = 0;
+	// Generated accessor of the path, which is used instead of the properties if the target is an instance of its class.
+	const FVarAccessNativeBinding* NativeBinding = nullptr;
+};
+
+// Identifies the place in the compiled Blueprint bytecode which calls the access function.
+struct FVarAccessCallSiteKey
+{
+	const UFunction* Function = nullptr;
+	int32 CodeOffset = INDEX_NONE;
+
+	bool IsValid() const
+	{
+		return Function != nullptr && CodeOffset != INDEX_NONE;
+	}
+
+	bool operator==(const FVarAccessCallSiteKey& Other) const
+	{
+		return Function == Other.Function && CodeOffset == Other.CodeOffset;
+	}
+
+	friend uint32 GetTypeHash(const FVarAccessCallSiteKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Function), GetTypeHash(Key.CodeOffset));
+	}
+};
+
+// Counters of the parse cache. The hits on the per-thread cache of each thread are added in batches.
+struct FVarAccessCacheStats
+{
+	uint64 L1Hits = 0;
+	uint64 SharedHits = 0;
+	uint64 Misses = 0;
+	// Lookups which waited for the lock held by another thread.
+	uint64 ContendedLocks = 0;
 };
 
 USTRUCT(BlueprintType)
@@ -45,6 +129,10 @@ struct VARIABLEACCESSFUNCTIONLIBRARY_API FAccessVariableParams
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Access Variable Options")
 	bool bIncludeGenerationClass = false;
 
+	// Remember the intermediate objects of the path per target if true, and re-walk only when a reference changes.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Access Variable Options")
+	bool bCacheObjectChain = false;
+
 	// Set.
 
 	// Create elements automatically if true when the element does not present.
@@ -52,6 +140,22 @@ struct VARIABLEACCESSFUNCTIONLIBRARY_API FAccessVariableParams
 	bool bExtendIfNotPresent = false;
 };
 
+// Array or map variable resolved once before a loop, so that the elements are indexed without resolving the path again.
+USTRUCT(BlueprintType)
+struct VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessContainerView
+{
+	GENERATED_BODY()
+
+	TWeakObjectPtr<UObject> Target;
+	FName VarName;
+	FAccessVariableParams Params;
+	// FArrayProperty or FMapProperty of the variable.
+	FProperty* Property = nullptr;
+	// Offset of the container from the target if it lives in the memory of the target, or INDEX_NONE.
+	int32 Offset = INDEX_NONE;
+	uint32 Epoch = 0;
+};
+
 UCLASS()
 class VARIABLEACCESSFUNCTIONLIBRARY_API UVariableAccessUtilLibrary : public UBlueprintFunctionLibrary
 {
@@ -64,10 +168,50 @@ public:
 
 namespace FVariableAccessFunctionLibraryUtils
 {
-VARIABLEACCESSFUNCTIONLIBRARY_API FProperty* GetScriptStructProperty(UScriptStruct* ScriptStruct, FString VarName);
+VARIABLEACCESSFUNCTIONLIBRARY_API FProperty* GetScriptStructProperty(UScriptStruct* ScriptStruct, const FString& VarName);
+// Find the property of the class or its superclasses by the table which is built per class on the first access.
+VARIABLEACCESSFUNCTIONLIBRARY_API FProperty* FindClassProperty(const UClass* Class, FName VarName);
+VARIABLEACCESSFUNCTIONLIBRARY_API TTuple<FProperty*, void*> ResolveTerminalProperty(const TArray<FVarDescription>& VarDescs,
+	int32 VarDepth, UObject* OuterObject, FProperty* ExpectedProperty, const FAccessVariableParams& Params);
+VARIABLEACCESSFUNCTIONLIBRARY_API TTuple<FProperty*, void*> ResolveTerminalProperty(const TArray<FVarDescription>& VarDescs,
+	int32 VarDepth, UObject* OuterObject, FProperty* ExpectedProperty, const FAccessVariableParams& Params,
+	FVarAccessLink* Links);
 VARIABLEACCESSFUNCTIONLIBRARY_API bool HandleTerminalProperty(const TArray<FVarDescription>& VarDescs, int32 VarDepth,
 	UObject* OuterObject, FProperty* Dest, void* DestAddr, FProperty* NewValue, void* NewValueAddr,
 	const FAccessVariableParams& Params);
 VARIABLEACCESSFUNCTIONLIBRARY_API void SplitVarName(const FString& In, TArray<FString>* Out);
 VARIABLEACCESSFUNCTIONLIBRARY_API void AnalyzeVarNames(const TArray<FString>& VarNames, TArray<FVarDescription>* VarDescs);
+VARIABLEACCESSFUNCTIONLIBRARY_API bool ParseVarName(const FString& VarName, TArray<FVarDescription>* VarDescs);
+VARIABLEACCESSFUNCTIONLIBRARY_API bool ParseVarName(FStringView VarName, TArray<FVarDescription>* VarDescs);
+VARIABLEACCESSFUNCTIONLIBRARY_API FVarDescription MakeVarDescription(const VarAccessPath::TSegmentView<TCHAR>& Segment);
+// False if the path is not supported on this version of the plugin.
+VARIABLEACCESSFUNCTIONLIBRARY_API bool IsSupportedVarDescs(const TArray<FVarDescription>& VarDescs);
+VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessCacheStats GetParseCacheStats();
+VARIABLEACCESSFUNCTIONLIBRARY_API void ResetParseCacheStats();
+VARIABLEACCESSFUNCTIONLIBRARY_API bool ApplyArguments(TArray<FVarDescription>* VarDescs, const FVarAccessArguments& Arguments);
+VARIABLEACCESSFUNCTIONLIBRARY_API TTuple<FProperty*, void*> ResolveTerminalProperty(
+	FVarAccessChain* Chain, UObject* OuterObject, FProperty* ExpectedProperty, const FAccessVariableParams& Params);
+VARIABLEACCESSFUNCTIONLIBRARY_API bool HandleTerminalProperty(FVarAccessChain* Chain, UObject* OuterObject, FProperty* Dest,
+	void* DestAddr, FProperty* NewValue, void* NewValueAddr, const FAccessVariableParams& Params);
+
+// Call site cache.
+VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessCallSiteKey MakeCallSiteKey(const FFrame& Stack);
+VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessChain* FindCallSiteChain(
+	const FVarAccessCallSiteKey& CallSite, UObject* Target, FName VarName, const FAccessVariableParams& Params);
+VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessChain* FindCallSiteChain(
+	const FVarAccessCallSiteKey& CallSite, UObject* Target, FStringView VarName, const FAccessVariableParams& Params);
+
+// Per-thread cache of the accesses without a call site. Return nullptr if the variable name is not supported.
+// The chain is valid until the next call on the same thread.
+VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessChain* FindThreadChain(
+	UObject* Target, FStringView VarName, const FAccessVariableParams& Params);
+
+VARIABLEACCESSFUNCTIONLIBRARY_API void InvalidateCaches();
+VARIABLEACCESSFUNCTIONLIBRARY_API uint32 GetCacheEpoch();
+
+// Container views.
+VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessContainerView MakeContainerView(UObject* Target, FName VarName,
+	const FAccessVariableParams& Params, FProperty* ContainerProperty, void* ContainerAddr);
+// Address of the container, or nullptr if the target is destroyed or the caches are invalidated after the view is made.
+VARIABLEACCESSFUNCTIONLIBRARY_API void* ResolveContainerView(const FVarAccessContainerView& View);
 }	 // namespace FVariableAccessFunctionLibraryUtils
@@ -0,0 +1,150 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessSnapshot.h"
+
+#include "VariableAccessJobSubsystem.generated.h"
+
+class UVariableAccessJobSubsystem;
+
+enum class EVarAccessJobMode : uint8
+{
+	Get,
+	Set
+};
+
+// Access to the same variable on a set of objects, which is executed every frame.
+struct FVarAccessJob
+{
+	TArray<TWeakObjectPtr<UObject>> Targets;
+	FString VarName;
+	FAccessVariableParams Params;
+	EVarAccessJobMode Mode = EVarAccessJobMode::Get;
+
+	// Type of the value, and one value per target owned by the caller (the destination on Get, the source on Set).
+	FProperty* ValueProperty = nullptr;
+	void* Buffer = nullptr;
+
+	// Optional. One flag per target which is updated on each execution.
+	bool* Succeeded = nullptr;
+
+	// Optional. Called on the game thread with the value of each target on Get.
+	TFunction<void(int32 TargetIndex, UObject* Target, const FProperty* Property, const void* ValueAddr)> Callback;
+
+	ETickingGroup TickGroup = TG_PrePhysics;
+
+	// Copy the values to Buffer on worker threads. Get only.
+	bool bParallel = false;
+};
+
+struct FVarAccessJobHandle
+{
+	int32 Id = INDEX_NONE;
+
+	bool IsValid() const
+	{
+		return Id != INDEX_NONE;
+	}
+};
+
+struct FVarAccessJobTickFunction : public FTickFunction
+{
+	UVariableAccessJobSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+		const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+// Executes the registered access jobs of the world in one tick function per tick group.
+// Jobs which access the same path share the resolved chain per class of the target.
+// The jobs may be registered, unregistered and retargeted from the callbacks. The changes apply after the jobs of the group.
+UCLASS()
+class VARIABLEACCESSFUNCTIONLIBRARY_API UVariableAccessJobSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	FVarAccessJobHandle RegisterJob(const FVarAccessJob& Job);
+	void UnregisterJob(FVarAccessJobHandle Handle);
+	void SetJobTargets(FVarAccessJobHandle Handle, const TArray<TWeakObjectPtr<UObject>>& Targets, void* Buffer, bool* Succeeded);
+
+	// Capture the snapshot once per frame in the tick group, after the jobs of the group.
+	void AddSnapshot(
+		const TSharedRef<FVarAccessSnapshot, ESPMode::ThreadSafe>& Snapshot, ETickingGroup TickGroup = TG_PostUpdateWork);
+	void RemoveSnapshot(const TSharedRef<FVarAccessSnapshot, ESPMode::ThreadSafe>& Snapshot);
+
+	void ExecuteJobs(ETickingGroup TickGroup);
+
+private:
+	struct FJobEntry
+	{
+		FVarAccessJob Job;
+		TArray<FVarDescription> VarDescs;
+		// Indices of the targets sorted by class, so that a chain is looked up once per run of the same class.
+		TArray<int32> Order;
+		TArray<TTuple<int32, void*>> Reads;
+	};
+
+	struct FPendingTargets
+	{
+		TArray<TWeakObjectPtr<UObject>> Targets;
+		void* Buffer = nullptr;
+		bool* Succeeded = nullptr;
+	};
+
+	struct FSnapshotEntry
+	{
+		TSharedPtr<FVarAccessSnapshot, ESPMode::ThreadSafe> Snapshot;
+		ETickingGroup TickGroup = TG_PostUpdateWork;
+	};
+
+	struct FChainKey
+	{
+		const UClass* Class = nullptr;
+		FString VarName;
+		bool bIncludeGenerationClass = false;
+
+		bool operator==(const FChainKey& Other) const
+		{
+			return Class == Other.Class && bIncludeGenerationClass == Other.bIncludeGenerationClass &&
+				   VarName.Equals(Other.VarName, ESearchCase::CaseSensitive);
+		}
+
+		friend uint32 GetTypeHash(const FChainKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Class), GetTypeHash(Key.VarName)), Key.bIncludeGenerationClass);
+		}
+	};
+
+	void SortTargets(FJobEntry* Entry);
+	FVarAccessChain* FindChain(const UClass* Class, const FJobEntry& Entry);
+	void ExecuteJob(FJobEntry* Entry);
+	void ApplyPendingChanges();
+	void EnsureTickFunction(ETickingGroup TickGroup);
+
+	TMap<int32, FJobEntry> Jobs;
+	int32 NextJobId = 0;
+	// Changes made while the jobs are executed, which must not change Jobs while it is iterated.
+	bool bExecutingJobs = false;
+	TMap<int32, FJobEntry> PendingJobs;
+	TSet<int32> PendingRemovals;
+	TMap<int32, FPendingTargets> PendingTargets;
+	TMap<FChainKey, FVarAccessChain> Chains;
+	TArray<FSnapshotEntry> Snapshots;
+	uint32 ChainsEpoch = 0;
+	TArray<TUniquePtr<FVarAccessJobTickFunction>> TickFunctions;
+};
@@ -0,0 +1,106 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "VariableAccessFunctionLibraryUtils.h"
+
+#include <atomic>
+
+// Native accessor of a variable path, which is generated by the GenerateNativeAccessors commandlet.
+// The accesses by name to the path on the class or its subclasses read and write the member by its C++ type.
+struct FVarAccessNativeAccessor
+{
+	// StaticClass of the class which declares the first member of the path.
+	UClass* (*GetClass)();
+	const TCHAR* VarName;
+	// Address of the member on the target, which is compared with the reflection data.
+	const void* (*GetAddress)(const UObject* Target);
+	// Assign the member to/from the value, which is an instance of the C++ type of the member.
+	void (*Read)(const UObject* Target, void* OutValue);
+	void (*Write)(UObject* Target, const void* Value);
+};
+
+// Type-erased entry points of the typed functions generated per path.
+template <typename T, const T& (*Get)(const UObject*), void (*Set)(UObject*, const T&)>
+struct TVarAccessNativeAccessorThunks
+{
+	static const void* GetAddress(const UObject* Target)
+	{
+		return &Get(Target);
+	}
+
+	static void Read(const UObject* Target, void* OutValue)
+	{
+		*static_cast<T*>(OutValue) = Get(Target);
+	}
+
+	static void Write(UObject* Target, const void* Value)
+	{
+		Set(Target, *static_cast<const T*>(Value));
+	}
+};
+
+template <typename T, const T& (*Get)(const UObject*), void (*Set)(UObject*, const T&)>
+constexpr FVarAccessNativeAccessor MakeVarAccessNativeAccessor(UClass* (*GetClass)(), const TCHAR* VarName)
+{
+	return {GetClass, VarName, &TVarAccessNativeAccessorThunks<T, Get, Set>::GetAddress,
+		&TVarAccessNativeAccessorThunks<T, Get, Set>::Read, &TVarAccessNativeAccessorThunks<T, Get, Set>::Write};
+}
+
+// Accessor bound to the property of the path. The bindings are never destroyed, so that the chains can refer to them.
+struct FVarAccessNativeBinding
+{
+	const UClass* Class = nullptr;
+	FProperty* Property = nullptr;
+	// nullptr until the accessor is verified, and after it is unregistered (e.g. the module which registered it is unloaded).
+	std::atomic<const FVarAccessNativeAccessor*> Accessor{nullptr};
+	// The address returned by the registered accessor is compared with the one resolved by the reflection on the first lookup.
+	const FVarAccessNativeAccessor* RegisteredAccessor = nullptr;
+	bool bVerified = false;
+};
+
+namespace FVariableAccessNativeAccessors
+{
+// Safe to call on the static initialization. The classes are resolved on the first lookup.
+VARIABLEACCESSFUNCTIONLIBRARY_API void Register(TArrayView<const FVarAccessNativeAccessor> Accessors);
+VARIABLEACCESSFUNCTIONLIBRARY_API void Unregister(TArrayView<const FVarAccessNativeAccessor> Accessors);
+VARIABLEACCESSFUNCTIONLIBRARY_API bool HasAccessors();
+// Binding of the path on the class or its superclasses, or nullptr.
+// The caches must be invalidated after the registration so that the existing chains find the accessors.
+VARIABLEACCESSFUNCTIONLIBRARY_API const FVarAccessNativeBinding* Find(const UClass* Class, FName VarName);
+// Property and address of the variable on the target, or nullptr if the binding does not apply to the target.
+VARIABLEACCESSFUNCTIONLIBRARY_API TTuple<FProperty*, void*> Resolve(
+	const FVarAccessNativeBinding& Binding, UObject* Target, FProperty* ExpectedProperty);
+// Write NewValue if it is not nullptr, and read the variable into Dest by the accessor.
+// Return false if the binding does not apply to the target, so that the caller falls back to the reflection.
+VARIABLEACCESSFUNCTIONLIBRARY_API bool Copy(const FVarAccessNativeBinding& Binding, UObject* Target, FProperty* Dest,
+	void* DestAddr, FProperty* NewValue, const void* NewValueAddr);
+}	 // namespace FVariableAccessNativeAccessors
+
+// Registers the accessors while it lives. The generated source file holds one as a static variable.
+class FVarAccessNativeAccessorRegistration
+{
+public:
+	explicit FVarAccessNativeAccessorRegistration(TArrayView<const FVarAccessNativeAccessor> InAccessors) : Accessors(InAccessors)
+	{
+		FVariableAccessNativeAccessors::Register(Accessors);
+	}
+
+	~FVarAccessNativeAccessorRegistration()
+	{
+		FVariableAccessNativeAccessors::Unregister(Accessors);
+	}
+
+	FVarAccessNativeAccessorRegistration(const FVarAccessNativeAccessorRegistration&) = delete;
+	FVarAccessNativeAccessorRegistration& operator=(const FVarAccessNativeAccessorRegistration&) = delete;
+
+private:
+	TArrayView<const FVarAccessNativeAccessor> Accessors;
+};
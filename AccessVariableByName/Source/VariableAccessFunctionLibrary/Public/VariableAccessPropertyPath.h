@@ -0,0 +1,32 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "VariableAccessFunctionLibraryUtils.h"
+
+struct FCachedPropertyPath;
+
+// Conversions between the variable path of this plugin and the property path of the engine (PropertyPathHelpers.h).
+// Include PropertyPathHelpers.h and add PropertyPath to the dependency modules to use FCachedPropertyPath.
+// The engine path has no map keys, so "Tags[\"Rare\"]" can not be converted. An integer index is resolved as the index of an
+// array by the engine, and bExtendIfNotPresent is not supported by the engine.
+namespace FVariableAccessPropertyPath
+{
+// Convert to the segments of the engine path (e.g. "Items[0]"). The placeholders must be substituted by ApplyArguments.
+// Return false if a segment is invalid, accesses a map by a string key or has a placeholder which is not substituted.
+VARIABLEACCESSFUNCTIONLIBRARY_API bool ToPropertyChain(const TArray<FVarDescription>& VarDescs, TArray<FString>* OutChain);
+VARIABLEACCESSFUNCTIONLIBRARY_API bool ToCachedPropertyPath(const FString& VarName, FCachedPropertyPath* OutPath,
+	const FVarAccessArguments& Arguments = FVarAccessArguments());
+// Return false if a segment is not a valid variable name of this plugin.
+VARIABLEACCESSFUNCTIONLIBRARY_API bool FromCachedPropertyPath(
+	const FCachedPropertyPath& Path, TArray<FVarDescription>* OutVarDescs);
+// Variable path of this plugin, which is parsed to the same descriptions.
+VARIABLEACCESSFUNCTIONLIBRARY_API FString ToVarName(const TArray<FVarDescription>& VarDescs);
+}	 // namespace FVariableAccessPropertyPath
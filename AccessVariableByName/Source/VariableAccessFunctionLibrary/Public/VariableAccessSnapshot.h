@@ -0,0 +1,169 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Containers/SparseArray.h"
+#include "Misc/Optional.h"
+#include "UObject/GarbageCollection.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessTypeTraits.h"
+
+#include <atomic>
+
+class FVarAccessSnapshot;
+
+struct FVarAccessSnapshotHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+};
+
+// Values of the registered variables captured at one frame. It is not changed while the readers hold it.
+class VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessSnapshotBuffer
+{
+public:
+	FVarAccessSnapshotBuffer() = default;
+	~FVarAccessSnapshotBuffer();
+
+	FVarAccessSnapshotBuffer(const FVarAccessSnapshotBuffer&) = delete;
+	FVarAccessSnapshotBuffer& operator=(const FVarAccessSnapshotBuffer&) = delete;
+
+	// Return the property and the address of the captured value, or nullptr if the variable was not captured.
+	TTuple<const FProperty*, const void*> Find(FVarAccessSnapshotHandle Handle) const;
+
+	uint64 GetFrameNumber() const
+	{
+		return FrameNumber;
+	}
+
+private:
+	friend class FVarAccessSnapshot;
+
+	struct FSlot
+	{
+		const FProperty* Property = nullptr;
+		int32 Offset = 0;
+		uint32 Serial = 0;
+		bool bCaptured = false;
+	};
+
+	void DestroyValues();
+
+	TArray<FSlot> Slots;
+	uint8* Data = nullptr;
+	int32 DataCapacity = 0;
+	uint64 FrameNumber = 0;
+	// Cache epoch on the capture. The properties of the slots may be destroyed after the caches are invalidated.
+	uint32 Epoch = 0;
+	mutable std::atomic<int32> NumReaders{0};
+};
+
+// Copies the registered variables on the game thread, and publishes the values to the readers on any thread.
+// The buffers are swapped on each capture, so the readers do not take a lock and always see the values of one frame.
+class VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessSnapshot
+{
+public:
+	FVarAccessSnapshot();
+	~FVarAccessSnapshot();
+
+	FVarAccessSnapshot(const FVarAccessSnapshot&) = delete;
+	FVarAccessSnapshot& operator=(const FVarAccessSnapshot&) = delete;
+
+	// Game thread only. If ValueProperty is set, the value is captured only when the variable has the same type.
+	// Otherwise, the type of the variable is used.
+	FVarAccessSnapshotHandle AddVariable(UObject* Target, const FString& VarName, FProperty* ValueProperty = nullptr,
+		const FAccessVariableParams& Params = FAccessVariableParams());
+	void RemoveVariable(FVarAccessSnapshotHandle Handle);
+
+	// Game thread only. Copy the variables to the free buffer and publish it.
+	// Return false if all buffers other than the published one are still held by the readers.
+	bool Capture();
+
+	// Any thread. Hold the latest published buffer while reading.
+	// Garbage collection is blocked while the scope lives, since it releases the buffers. The snapshot must outlive the scope.
+	class VARIABLEACCESSFUNCTIONLIBRARY_API FReadScope
+	{
+	public:
+		explicit FReadScope(const FVarAccessSnapshot& Snapshot);
+		~FReadScope();
+
+		FReadScope(const FReadScope&) = delete;
+		FReadScope& operator=(const FReadScope&) = delete;
+
+		// nullptr if nothing is captured yet.
+		const FVarAccessSnapshotBuffer* GetBuffer() const
+		{
+			return Buffer;
+		}
+
+		template <typename T>
+		TOptional<T> Get(FVarAccessSnapshotHandle Handle) const
+		{
+			if (Buffer == nullptr)
+			{
+				return TOptional<T>();
+			}
+
+			TTuple<const FProperty*, const void*> Value = Buffer->Find(Handle);
+			const FProperty* Property = Value.Get<0>();
+			if (Property == nullptr || !TVarAccessValueTraits<T>::IsCompatible(Property))
+			{
+				return TOptional<T>();
+			}
+
+			T Result;
+			if (!TVarAccessValueTraits<T>::Read(Property, Value.Get<1>(), &Result))
+			{
+				return TOptional<T>();
+			}
+
+			return TOptional<T>(MoveTemp(Result));
+		}
+
+	private:
+		FGCScopeGuard GCGuard;
+		const FVarAccessSnapshotBuffer* Buffer = nullptr;
+	};
+
+private:
+	// One is published, one may be still held by the readers of the previous frame, and one is written.
+	static const int32 NumBuffers = 3;
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UObject> Target;
+		FProperty* ValueProperty = nullptr;
+		FAccessVariableParams Params;
+		FVarAccessChain Chain;
+		uint32 Serial = 0;
+	};
+
+	const FVarAccessSnapshotBuffer* AcquireBuffer() const;
+	// Unpublish the buffers captured before the caches were invalidated (or all buffers if bAll is true), and destroy their
+	// values unless the readers hold them. The buffers held by the readers are released on a later call.
+	void ReleaseBuffers(bool bAll);
+	void OnPreGarbageCollect();
+
+	TSparseArray<FEntry> Entries;
+	uint32 NextSerial = 1;
+	uint32 ChainsEpoch = 0;
+	// Address of the variable per entry on the capture. Kept to avoid the allocation per capture.
+	TArray<const void*> SourceAddrs;
+
+	FVarAccessSnapshotBuffer Buffers[NumBuffers];
+	// Index of the published buffer, or INDEX_NONE before the first capture and after the buffers are released.
+	std::atomic<int32> PublishedIndex{INDEX_NONE};
+	FDelegateHandle PreGarbageCollectHandle;
+};
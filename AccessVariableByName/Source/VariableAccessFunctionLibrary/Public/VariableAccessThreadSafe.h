@@ -0,0 +1,77 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Misc/Optional.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/GarbageCollection.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessTypeTraits.h"
+
+// Read-only access which can be used from any thread.
+// Garbage collection is blocked while reading, and the variable is never created (bExtendIfNotPresent is ignored).
+// The values are read from the live objects, so a value written on the game thread at the same time may be torn.
+// See docs/cpp_api.md for details.
+namespace FVariableAccessThreadSafe
+{
+// Held for write while the library changes the structure of a container (e.g. adds an item to an array).
+// Game thread code which changes the containers read from other threads should also hold it for write.
+VARIABLEACCESSFUNCTIONLIBRARY_API FRWLock& GetContainerLock();
+
+// Holds the container lock for read. Paths which access an array/map element are refused without it.
+class FContainerReadScope
+{
+public:
+	FContainerReadScope() : Lock(GetContainerLock())
+	{
+	}
+
+private:
+	FReadScopeLock Lock;
+};
+
+// The terminal is valid until the garbage collection guard held by the caller is released.
+VARIABLEACCESSFUNCTIONLIBRARY_API TTuple<FProperty*, void*> ResolveVariable(UObject* Target, FName VarName,
+	const FAccessVariableParams& Params, const FContainerReadScope* ContainerReadScope);
+// Resolve only the variable which lives in the memory of the target itself (reached through structure members).
+// The offset is cached per class, so the access after the first one does not walk the path.
+VARIABLEACCESSFUNCTIONLIBRARY_API TTuple<FProperty*, void*> ResolveInlineVariable(
+	UObject* Target, FName VarName, const FAccessVariableParams& Params);
+VARIABLEACCESSFUNCTIONLIBRARY_API bool GenericGetNestedVariableByName(UObject* Target, FName VarName, FProperty* ResultProperty,
+	void* ResultAddr, const FAccessVariableParams& Params, const FContainerReadScope* ContainerReadScope = nullptr);
+
+// Release the cached paths. Called on the game thread when the caches are invalidated.
+VARIABLEACCESSFUNCTIONLIBRARY_API void ResetCache();
+// Number of the replaced tables which wait for the readers started before the replacement. Game thread only.
+VARIABLEACCESSFUNCTIONLIBRARY_API int32 GetNumRetiredTables();
+
+// Get the variable. The result is unset if the variable is not found, its type is not T or the path is refused.
+template <typename T>
+TOptional<T> GetNestedVariableByName(UObject* Target, FName VarName,
+	const FAccessVariableParams& Params = FAccessVariableParams(), const FContainerReadScope* ContainerReadScope = nullptr)
+{
+	FGCScopeGuard GCGuard;
+
+	TTuple<FProperty*, void*> Terminal = ResolveVariable(Target, VarName, Params, ContainerReadScope);
+	FProperty* Property = Terminal.Get<0>();
+	if (Property == nullptr || !TVarAccessValueTraits<T>::IsCompatible(Property))
+	{
+		return TOptional<T>();
+	}
+
+	T Value;
+	if (!TVarAccessValueTraits<T>::Read(Property, Terminal.Get<1>(), &Value))
+	{
+		return TOptional<T>();
+	}
+
+	return TOptional<T>(MoveTemp(Value));
+}
+}	 // namespace FVariableAccessThreadSafe
@@ -0,0 +1,115 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Templates/EnableIf.h"
+#include "Templates/UnrealTypeTraits.h"
+#include "UObject/Class.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+#include <type_traits>
+
+// Check and copy the value of a resolved variable as a C++ type.
+// The primary template handles structures (USTRUCT and the core structures such as FVector).
+template <typename T, typename Enable = void>
+struct TVarAccessValueTraits
+{
+	static bool IsCompatible(const FProperty* Property)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		return StructProperty != nullptr && StructProperty->Struct == TBaseStructure<T>::Get();
+	}
+
+	static bool Read(const FProperty* Property, const void* Addr, T* Out)
+	{
+		Copy(Property, Out, Addr, std::is_trivially_copyable<T>());
+		return true;
+	}
+
+	static bool Write(const FProperty* Property, void* Addr, const T& Value)
+	{
+		Copy(Property, Addr, &Value, std::is_trivially_copyable<T>());
+		return true;
+	}
+
+private:
+	// The property has the type T, so the structure which is trivially copyable in C++ is copied without the dispatch.
+	static void Copy(const FProperty*, void* Dest, const void* Src, std::true_type)
+	{
+		FMemory::Memcpy(Dest, Src, sizeof(T));
+	}
+
+	static void Copy(const FProperty* Property, void* Dest, const void* Src, std::false_type)
+	{
+		Property->CopyCompleteValue(Dest, Src);
+	}
+};
+
+#define AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(Type, PropertyType)                        \
+	template <>                                                                          \
+	struct TVarAccessValueTraits<Type>                                                   \
+	{                                                                                    \
+		static bool IsCompatible(const FProperty* Property)                              \
+		{                                                                                \
+			return Property->IsA<PropertyType>();                                        \
+		}                                                                                \
+		static bool Read(const FProperty* Property, const void* Addr, Type* Out)         \
+		{                                                                                \
+			*Out = CastFieldChecked<PropertyType>(Property)->GetPropertyValue(Addr);     \
+			return true;                                                                 \
+		}                                                                                \
+		static bool Write(const FProperty* Property, void* Addr, const Type& Value)      \
+		{                                                                                \
+			CastFieldChecked<PropertyType>(Property)->SetPropertyValue(Addr, Value);     \
+			return true;                                                                 \
+		}                                                                                \
+	};
+
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(bool, FBoolProperty)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(uint8, FByteProperty)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(int32, FIntProperty)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(int64, FInt64Property)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(float, FFloatProperty)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(double, FDoubleProperty)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(FName, FNameProperty)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(FString, FStrProperty)
+AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS(FText, FTextProperty)
+
+#undef AVBN_DEFINE_VAR_ACCESS_VALUE_TRAITS
+
+// Object references. The value of the variable may be a subclass of T, and the value to set must be an instance of the
+// class of the variable.
+template <typename T>
+struct TVarAccessValueTraits<T*, typename TEnableIf<TIsDerivedFrom<T, UObject>::Value>::Type>
+{
+	static bool IsCompatible(const FProperty* Property)
+	{
+		const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
+		return ObjectProperty != nullptr && ObjectProperty->PropertyClass->IsChildOf(T::StaticClass());
+	}
+
+	static bool Read(const FProperty* Property, const void* Addr, T** Out)
+	{
+		*Out = Cast<T>(CastFieldChecked<FObjectPropertyBase>(Property)->GetObjectPropertyValue(Addr));
+		return true;
+	}
+
+	static bool Write(const FProperty* Property, void* Addr, T* const& Value)
+	{
+		const FObjectPropertyBase* ObjectProperty = CastFieldChecked<FObjectPropertyBase>(Property);
+		if (Value != nullptr && !Value->IsA(ObjectProperty->PropertyClass))
+		{
+			return false;
+		}
+		ObjectProperty->SetObjectPropertyValue(Addr, Value);
+		return true;
+	}
+};
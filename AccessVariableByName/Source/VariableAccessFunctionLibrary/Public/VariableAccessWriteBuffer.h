@@ -0,0 +1,138 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessTypeTraits.h"
+
+#include <atomic>
+
+enum class EVarAccessWriteStatus : uint8
+{
+	// The value is written (or merged into the written value).
+	Written,
+	// A later write to the same variable of the same object is written instead.
+	Superseded,
+	// The target is destroyed before the flush.
+	InvalidTarget,
+	// The variable is not found or its type does not match.
+	NotFound
+};
+
+struct FVarAccessWriteResult
+{
+	uint64 WriteId = 0;
+	EVarAccessWriteStatus Status = EVarAccessWriteStatus::NotFound;
+};
+
+// The variable to write and the type of the value, which are parsed once on the game thread.
+// Keep it alive until the writes which use it are flushed.
+class VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessWritePath
+{
+public:
+	// Merge the incoming value into the accumulated value. The writes are merged in the order of enqueue.
+	using FMergeFunction = TFunction<void(const FProperty* Property, void* AccumulatedAddr, const void* IncomingAddr)>;
+
+	// Return nullptr if the variable name is invalid. The last write wins if Merge is not set.
+	static TSharedPtr<FVarAccessWritePath, ESPMode::ThreadSafe> Create(const FString& VarName, FProperty* ValueProperty,
+		const FAccessVariableParams& Params = FAccessVariableParams(), FMergeFunction Merge = nullptr);
+
+	const FProperty* GetValueProperty() const
+	{
+		return ValueProperty;
+	}
+
+private:
+	friend class FVarAccessWriteBuffer;
+
+	FVarAccessChain* FindChain(const UClass* Class);
+
+	TArray<FVarDescription> VarDescs;
+	FProperty* ValueProperty = nullptr;
+	FAccessVariableParams Params;
+	FMergeFunction Merge;
+
+	// Game thread only.
+	TMap<const UClass*, FVarAccessChain> Chains;
+	uint32 ChainsEpoch = 0;
+};
+
+// Collects the writes from any thread, and applies them on the game thread in one batch.
+// Each producer enqueues to its own FWriter without synchronization, and the writer hands its commands over to the buffer
+// with one atomic operation.
+class VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessWriteBuffer
+{
+	struct FCommand
+	{
+		TWeakObjectPtr<UObject> Target;
+		FVarAccessWritePath* Path = nullptr;
+		int32 ValueOffset = 0;
+		uint64 WriteId = 0;
+	};
+
+	struct FBlock
+	{
+		TArray<FCommand> Commands;
+		TArray<uint8, TAlignedHeapAllocator<16>> Values;
+		FBlock* Next = nullptr;
+
+		~FBlock();
+	};
+
+public:
+	FVarAccessWriteBuffer() = default;
+	~FVarAccessWriteBuffer();
+
+	FVarAccessWriteBuffer(const FVarAccessWriteBuffer&) = delete;
+	FVarAccessWriteBuffer& operator=(const FVarAccessWriteBuffer&) = delete;
+
+	// Used by one thread at a time. The commands are submitted on destruction.
+	class VARIABLEACCESSFUNCTIONLIBRARY_API FWriter
+	{
+	public:
+		explicit FWriter(FVarAccessWriteBuffer& Buffer);
+		~FWriter();
+
+		FWriter(const FWriter&) = delete;
+		FWriter& operator=(const FWriter&) = delete;
+
+		// Copy the value which has the type of the path. Return the id to find the result of the write.
+		uint64 EnqueueValue(UObject* Target, FVarAccessWritePath& Path, const void* ValueAddr);
+
+		// Return 0 if T is not compatible with the type of the path.
+		template <typename T>
+		uint64 Enqueue(UObject* Target, FVarAccessWritePath& Path, const T& Value)
+		{
+			if (!TVarAccessValueTraits<T>::IsCompatible(Path.GetValueProperty()))
+			{
+				return 0;
+			}
+			return EnqueueValue(Target, Path, &Value);
+		}
+
+		// Hand over the enqueued commands to the buffer.
+		void Submit();
+
+	private:
+		FVarAccessWriteBuffer& Buffer;
+		FBlock* Block = nullptr;
+	};
+
+	// Game thread only. Apply all submitted writes, sorted by the object and the variable.
+	// OutResults receives one result per write if it is set. Return the number of the written variables.
+	int32 Flush(TArray<FVarAccessWriteResult>* OutResults = nullptr);
+
+private:
+	void Push(FBlock* Block);
+
+	std::atomic<FBlock*> Head{nullptr};
+	// Write ids start from 1, so that 0 means the failed enqueue.
+	std::atomic<uint64> NextWriteId{1};
+};
@@ -0,0 +1,169 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Misc/Optional.h"
+#include "PathCore/VarAccessStaticPath.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessTypeTraits.h"
+
+// Typed access to a variable by name from C++ code. Game thread only.
+// The path is parsed once on construction, and the resolved properties are cached per class of the target.
+// The type of the variable is checked against T when a property is resolved for the first time.
+template <typename T>
+class TVariableAccessor
+{
+public:
+	explicit TVariableAccessor(const FString& VarName, const FAccessVariableParams& InParams = FAccessVariableParams())
+		: Params(InParams)
+	{
+		bIsValid = FVariableAccessFunctionLibraryUtils::ParseVarName(VarName, &VarDescs) && VarDescs.Num() > 0;
+		for (const FVarDescription& Desc : VarDescs)
+		{
+			bIsValid &= Desc.bIsValid;
+		}
+
+		ReadParams = Params;
+		ReadParams.bExtendIfNotPresent = false;
+	}
+
+	// The path parsed at compile time by VAR_ACCESS_STATIC_PATH. Only the names are converted to FName here.
+	template <size_t MaxSegments>
+	explicit TVariableAccessor(
+		const VarAccessPath::TStaticPath<TCHAR, MaxSegments>& Path, const FAccessVariableParams& InParams = FAccessVariableParams())
+		: Params(InParams)
+	{
+		VarDescs.Reserve(static_cast<int32>(Path.NumSegments));
+		for (size_t Index = 0; Index < Path.NumSegments; ++Index)
+		{
+			VarDescs.Add(FVariableAccessFunctionLibraryUtils::MakeVarDescription(Path.Segments[Index]));
+		}
+		bIsValid = Path.bIsValid && FVariableAccessFunctionLibraryUtils::IsSupportedVarDescs(VarDescs);
+
+		ReadParams = Params;
+		ReadParams.bExtendIfNotPresent = false;
+	}
+
+	// The cached chains are referred to by address.
+	TVariableAccessor(const TVariableAccessor&) = delete;
+	TVariableAccessor& operator=(const TVariableAccessor&) = delete;
+
+	// False if the path is malformed or not supported.
+	bool IsValid() const
+	{
+		return bIsValid;
+	}
+
+	// The result is unset if the variable is not found or its type is not T. The variable is never created.
+	TOptional<T> Get(UObject* Object) const
+	{
+		TTuple<FProperty*, void*> Terminal = Resolve(Object, ReadParams);
+		if (Terminal.Get<0>() == nullptr)
+		{
+			return TOptional<T>();
+		}
+
+		T Value;
+		if (!TVarAccessValueTraits<T>::Read(Terminal.Get<0>(), Terminal.Get<1>(), &Value))
+		{
+			return TOptional<T>();
+		}
+
+		return TOptional<T>(MoveTemp(Value));
+	}
+
+	// Return false if the variable is not found or its type is not T.
+	// The element is created if bExtendIfNotPresent is set, before the type of the element is checked.
+	bool Set(UObject* Object, const T& Value) const
+	{
+		TTuple<FProperty*, void*> Terminal = Resolve(Object, Params);
+		if (Terminal.Get<0>() == nullptr)
+		{
+			return false;
+		}
+
+		return TVarAccessValueTraits<T>::Write(Terminal.Get<0>(), Terminal.Get<1>(), Value);
+	}
+
+private:
+	TTuple<FProperty*, void*> Resolve(UObject* Object, const FAccessVariableParams& InParams) const
+	{
+		const TTuple<FProperty*, void*> NullReturn(nullptr, nullptr);
+
+		if (!bIsValid || Object == nullptr)
+		{
+			return NullReturn;
+		}
+
+		TTuple<FProperty*, void*> Terminal =
+			FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(FindChain(Object->GetClass()), Object, nullptr, InParams);
+		FProperty* Property = Terminal.Get<0>();
+		if (Property == nullptr || Terminal.Get<1>() == nullptr)
+		{
+			return NullReturn;
+		}
+
+		// The path may reach properties of different classes through object references, so the check is cached per
+		// property rather than per accessor.
+		if (Property != CompatibleProperty)
+		{
+			if (!TVarAccessValueTraits<T>::IsCompatible(Property))
+			{
+				return NullReturn;
+			}
+			CompatibleProperty = Property;
+		}
+
+		return Terminal;
+	}
+
+	FVarAccessChain* FindChain(const UClass* Class) const
+	{
+		const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+		if (ChainsEpoch != Epoch)
+		{
+			// The properties may be destroyed.
+			Chains.Reset();
+			LastClass = nullptr;
+			LastChain = nullptr;
+			CompatibleProperty = nullptr;
+			ChainsEpoch = Epoch;
+		}
+
+		if (Class == LastClass)
+		{
+			return LastChain;
+		}
+
+		FVarAccessChain* Chain = Chains.Find(Class);
+		if (Chain == nullptr)
+		{
+			Chain = &Chains.Add(Class);
+			Chain->VarDescs = VarDescs;
+			Chain->Links.SetNum(VarDescs.Num());
+		}
+		LastClass = Class;
+		LastChain = Chain;
+
+		return Chain;
+	}
+
+	TArray<FVarDescription> VarDescs;
+	FAccessVariableParams Params;
+	FAccessVariableParams ReadParams;
+	bool bIsValid = false;
+
+	mutable TMap<const UClass*, FVarAccessChain> Chains;
+	mutable uint32 ChainsEpoch = 0;
+	// The chain of the last class, which avoids the lookup of the map while the same class is accessed.
+	mutable const UClass* LastClass = nullptr;
+	mutable FVarAccessChain* LastChain = nullptr;
+	mutable const FProperty* CompatibleProperty = nullptr;
+};
@@ -0,0 +1,161 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+
+#include "VariableArrayFunctionLibrary.generated.h"
+
+// Operate an array variable in place. The array is accessed through the resolved address, so no copy of the whole array is made.
+UCLASS()
+class VARIABLEACCESSFUNCTIONLIBRARY_API UVariableArrayFunctionLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	static int32 GenericArrayAddByName(UObject* Target, FName VarName, bool& Success, FProperty* NewItemProperty,
+		void* NewItemAddr, const FAccessVariableParams& Params);
+	static int32 GenericArrayAddUniqueByName(UObject* Target, FName VarName, bool& Success, FProperty* NewItemProperty,
+		void* NewItemAddr, const FAccessVariableParams& Params);
+	static void GenericArrayInsertByName(UObject* Target, FName VarName, int32 Index, bool& Success, FProperty* NewItemProperty,
+		void* NewItemAddr, const FAccessVariableParams& Params);
+	static void GenericArrayGetByView(
+		const FVarAccessContainerView& View, int32 Index, bool& Success, FProperty* ItemProperty, void* ItemAddr);
+
+	// Resolve the array variable once for a loop, and return the number of the items.
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly)
+	static int32 ArrayViewByName(
+		UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, FVarAccessContainerView& View);
+
+	// Copy the item at the index of the array resolved by ArrayViewByName.
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Item"))
+	static void ArrayGetByView(const FVarAccessContainerView& View, int32 Index, bool& Success, UProperty*& Item);
+
+	DECLARE_FUNCTION(execArrayGetByView)
+	{
+		P_GET_STRUCT_REF(FVarAccessContainerView, View);
+		P_GET_PROPERTY(FIntProperty, Index);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* ItemAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ItemProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericArrayGetByView(View, Index, Success, ItemProperty, ItemAddr);
+
+		P_NATIVE_END;
+	}
+
+	// Add an item to the end of the array variable, and return the index of the added item.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Array",
+		meta = (DefaultToSelf = "Target", CustomStructureParam = "NewItem"))
+	static int32 ArrayAddByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* NewItem);
+
+	DECLARE_FUNCTION(execArrayAddByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* NewItemAddr = Stack.MostRecentPropertyAddress;
+		FProperty* NewItemProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		*(int32*) RESULT_PARAM = GenericArrayAddByName(Target, VarName, Success, NewItemProperty, NewItemAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Add an item to the end of the array variable if the same item does not exist, and return the index of the item.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Array",
+		meta = (DefaultToSelf = "Target", CustomStructureParam = "NewItem"))
+	static int32 ArrayAddUniqueByName(
+		UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* NewItem);
+
+	DECLARE_FUNCTION(execArrayAddUniqueByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* NewItemAddr = Stack.MostRecentPropertyAddress;
+		FProperty* NewItemProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		*(int32*) RESULT_PARAM = GenericArrayAddUniqueByName(Target, VarName, Success, NewItemProperty, NewItemAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Insert an item at the index of the array variable.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Array",
+		meta = (DefaultToSelf = "Target", CustomStructureParam = "NewItem"))
+	static void ArrayInsertByName(
+		UObject* Target, FName VarName, int32 Index, FAccessVariableParams Params, bool& Success, UProperty* NewItem);
+
+	DECLARE_FUNCTION(execArrayInsertByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_PROPERTY(FIntProperty, Index);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* NewItemAddr = Stack.MostRecentPropertyAddress;
+		FProperty* NewItemProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericArrayInsertByName(Target, VarName, Index, Success, NewItemProperty, NewItemAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Remove the item at the index of the array variable.
+	UFUNCTION(BlueprintCallable, Category = "Access Variable by Name|Array", meta = (DefaultToSelf = "Target"))
+	static void ArrayRemoveAtByName(UObject* Target, FName VarName, int32 Index, FAccessVariableParams Params, bool& Success);
+
+	// Remove the item at the index of the array variable by moving the last item into its place. The order is not kept.
+	UFUNCTION(BlueprintCallable, Category = "Access Variable by Name|Array", meta = (DefaultToSelf = "Target"))
+	static void ArrayRemoveAtSwapByName(UObject* Target, FName VarName, int32 Index, FAccessVariableParams Params, bool& Success);
+
+	// Remove all items of the array variable, and keep the allocation for the number of items specified by Slack.
+	UFUNCTION(BlueprintCallable, Category = "Access Variable by Name|Array", meta = (DefaultToSelf = "Target"))
+	static void ArrayEmptyByName(UObject* Target, FName VarName, int32 Slack, FAccessVariableParams Params, bool& Success);
+
+	// Allocate the memory for the number of items on the empty array variable.
+	// The non-empty array grows geometrically by adding items, so this function does nothing on it.
+	UFUNCTION(BlueprintCallable, Category = "Access Variable by Name|Array", meta = (DefaultToSelf = "Target"))
+	static void ArrayReserveByName(UObject* Target, FName VarName, int32 Number, FAccessVariableParams Params, bool& Success);
+
+	// Return the number of items of the array variable.
+	UFUNCTION(BlueprintPure, Category = "Access Variable by Name|Array", meta = (DefaultToSelf = "Target"))
+	static int32 ArrayNumByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success);
+};
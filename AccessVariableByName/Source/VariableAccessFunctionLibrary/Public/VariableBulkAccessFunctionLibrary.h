@@ -0,0 +1,155 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Engine/LatentActionManager.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessJobSubsystem.h"
+
+#include "VariableBulkAccessFunctionLibrary.generated.h"
+
+// Gets or sets the same variable on many objects, processing as many targets as the budget allows on each step.
+class VARIABLEACCESSFUNCTIONLIBRARY_API FVarAccessBulkOperation
+{
+public:
+	// NewValueAddr is copied, and used on Set only.
+	FVarAccessBulkOperation(EVarAccessJobMode Mode, const TArray<TWeakObjectPtr<UObject>>& Targets, const FString& VarName,
+		FProperty* ValueProperty, const void* NewValueAddr, const FAccessVariableParams& Params);
+	~FVarAccessBulkOperation();
+
+	FVarAccessBulkOperation(const FVarAccessBulkOperation&) = delete;
+	FVarAccessBulkOperation& operator=(const FVarAccessBulkOperation&) = delete;
+
+	// Process the targets until the budget is spent. Return true when the operation is finished.
+	bool Step(double BudgetSeconds);
+	void Cancel();
+
+	bool IsFinished() const;
+	bool IsCancelled() const;
+	float GetProgress() const;
+	int32 GetNumSucceeded() const;
+
+	// Copy the value got from the target. Return false if the access to the target has failed.
+	bool GetValue(int32 TargetIndex, void* OutValueAddr) const;
+	// Copy the values got from all targets to the array. The item of the failed target is the default value.
+	void CopyValuesToArray(FArrayProperty* ArrayProperty, void* ArrayAddr) const;
+
+private:
+	void ProcessTarget(int32 TargetIndex);
+
+	EVarAccessJobMode Mode;
+	TArray<TWeakObjectPtr<UObject>> Targets;
+	FProperty* ValueProperty = nullptr;
+	FAccessVariableParams Params;
+	bool bIsValidPath = false;
+	TArray<FVarDescription> VarDescs;
+	TMap<const UClass*, FVarAccessChain> Chains;
+	uint32 ChainsEpoch = 0;
+
+	// The new value on Set, and the values of all targets on Get.
+	uint8* Values = nullptr;
+	TBitArray<> Succeeded;
+	int32 NumSucceeded = 0;
+	int32 NextTargetIndex = 0;
+	bool bCancelled = false;
+};
+
+UCLASS()
+class VARIABLEACCESSFUNCTIONLIBRARY_API UVariableBulkAccessFunctionLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Run the operation on the core ticker within the budget per frame, and call OnFinished when it is finished or cancelled.
+	static void RunBulkOperation(const TSharedRef<FVarAccessBulkOperation>& Operation, double BudgetSeconds,
+		TFunction<void(FVarAccessBulkOperation&)> OnFinished);
+
+	static void GenericBulkGetNestedVariableByName(UObject* WorldContextObject, const TArray<UObject*>& Targets, FName VarName,
+		const FAccessVariableParams& Params, float BudgetMilliseconds, FName OperationName, FLatentActionInfo LatentInfo,
+		int32* NumSucceeded, FArrayProperty* ValuesProperty, void* ValuesAddr);
+	static void GenericBulkSetNestedVariableByName(UObject* WorldContextObject, const TArray<UObject*>& Targets, FName VarName,
+		const FAccessVariableParams& Params, float BudgetMilliseconds, FName OperationName, FLatentActionInfo LatentInfo,
+		int32* NumSucceeded, FProperty* NewValueProperty, void* NewValueAddr);
+
+	// Get the variable from all targets over several frames. Values has one item per target.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Bulk",
+		meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", ArrayParm = "Values"))
+	static void BulkGetNestedVariableByName(UObject* WorldContextObject, const TArray<UObject*>& Targets, FName VarName,
+		FAccessVariableParams Params, float BudgetMilliseconds, FName OperationName, FLatentActionInfo LatentInfo,
+		int32& NumSucceeded, TArray<int32>& Values);
+
+	DECLARE_FUNCTION(execBulkGetNestedVariableByName)
+	{
+		P_GET_OBJECT(UObject, WorldContextObject);
+		P_GET_TARRAY_REF(UObject*, Targets);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY(FFloatProperty, BudgetMilliseconds);
+		P_GET_PROPERTY(FNameProperty, OperationName);
+		P_GET_STRUCT(FLatentActionInfo, LatentInfo);
+		P_GET_PROPERTY_REF(FIntProperty, NumSucceeded);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ValuesAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ValuesProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericBulkGetNestedVariableByName(WorldContextObject, Targets, VarName, Params, BudgetMilliseconds, OperationName,
+			LatentInfo, &NumSucceeded, ValuesProperty, ValuesAddr);
+
+		P_NATIVE_END;
+	}
+
+	// Set the variable of all targets over several frames.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Bulk",
+		meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", CustomStructureParam = "NewValue"))
+	static void BulkSetNestedVariableByName(UObject* WorldContextObject, const TArray<UObject*>& Targets, FName VarName,
+		FAccessVariableParams Params, float BudgetMilliseconds, FName OperationName, FLatentActionInfo LatentInfo,
+		int32& NumSucceeded, UProperty* NewValue);
+
+	DECLARE_FUNCTION(execBulkSetNestedVariableByName)
+	{
+		P_GET_OBJECT(UObject, WorldContextObject);
+		P_GET_TARRAY_REF(UObject*, Targets);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY(FFloatProperty, BudgetMilliseconds);
+		P_GET_PROPERTY(FNameProperty, OperationName);
+		P_GET_STRUCT(FLatentActionInfo, LatentInfo);
+		P_GET_PROPERTY_REF(FIntProperty, NumSucceeded);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* NewValueAddr = Stack.MostRecentPropertyAddress;
+		FProperty* NewValueProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericBulkSetNestedVariableByName(WorldContextObject, Targets, VarName, Params, BudgetMilliseconds, OperationName,
+			LatentInfo, &NumSucceeded, NewValueProperty, NewValueAddr);
+
+		P_NATIVE_END;
+	}
+
+	// Return the progress (0 to 1) of the running bulk operation started with the name, or -1 if it is not running.
+	UFUNCTION(BlueprintPure, Category = "Access Variable by Name|Bulk")
+	static float GetBulkOperationProgress(FName OperationName);
+
+	// Cancel the running bulk operation started with the name. The latent node finishes on the next frame.
+	UFUNCTION(BlueprintCallable, Category = "Access Variable by Name|Bulk")
+	static void CancelBulkOperation(FName OperationName);
+};
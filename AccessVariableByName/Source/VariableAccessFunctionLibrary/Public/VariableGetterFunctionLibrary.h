@@ -22,6 +22,15 @@ class VARIABLEACCESSFUNCTIONLIBRARY_API UVariableGetterFunctionLibarary : public
 public:
 	static void GenericGetNestedVariableByName(UObject* Target, FName VarName, bool& Success, FProperty* ResultProperty,
 		void* ResultAddr, const FAccessVariableParams& Params);
+	static void GenericGetNestedVariableByName(const FVarAccessCallSiteKey& CallSite, UObject* Target, FName VarName,
+		const FVarAccessArguments* Arguments, bool& Success, FProperty* ResultProperty, void* ResultAddr,
+		const FAccessVariableParams& Params);
+	static void GenericGetNestedVariableByString(UObject* Target, FStringView VarName, bool& Success,
+		FProperty* ResultProperty, void* ResultAddr, const FAccessVariableParams& Params);
+	static void GenericGetNestedVariableByString(const FVarAccessCallSiteKey& CallSite, UObject* Target, FStringView VarName,
+		bool& Success, FProperty* ResultProperty, void* ResultAddr, const FAccessVariableParams& Params);
+	static void GenericGetNestedVariableByNameThreadSafe(UObject* Target, FName VarName, bool& Success,
+		FProperty* ResultProperty, void* ResultAddr, const FAccessVariableParams& Params);
 
 	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result"))
 	static void GetNestedVariableByName(
@@ -29,6 +38,7 @@ public:
 
 	DECLARE_FUNCTION(execGetNestedVariableByName)
 	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
 		P_GET_OBJECT(UObject, Target);
 		P_GET_PROPERTY(FNameProperty, VarName);
 		P_GET_STRUCT(FAccessVariableParams, Params);
@@ -41,7 +51,7 @@ public:
 
 		P_NATIVE_BEGIN;
 
-		GenericGetNestedVariableByName(Target, VarName, Success, ResultProperty, ResultAddr, Params);
+		GenericGetNestedVariableByName(CallSite, Target, VarName, nullptr, Success, ResultProperty, ResultAddr, Params);
 
 		P_NATIVE_END;
 	}
@@ -52,6 +62,7 @@ public:
 
 	DECLARE_FUNCTION(execGetNestedVariableByNamePure)
 	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
 		P_GET_OBJECT(UObject, Target);
 		P_GET_PROPERTY(FNameProperty, VarName);
 		P_GET_STRUCT(FAccessVariableParams, Params);
@@ -64,7 +75,138 @@ public:
 
 		P_NATIVE_BEGIN;
 
-		GenericGetNestedVariableByName(Target, VarName, Success, ResultProperty, ResultAddr, Params);
+		GenericGetNestedVariableByName(CallSite, Target, VarName, nullptr, Success, ResultProperty, ResultAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Only the variable which lives in the memory of the target itself is got, so that it can run on worker threads.
+	UFUNCTION(BlueprintPure, BlueprintInternalUseOnly, CustomThunk,
+		meta = (CustomStructureParam = "Result", BlueprintThreadSafe))
+	static void GetNestedVariableByNameThreadSafe(
+		UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty*& Result);
+
+	DECLARE_FUNCTION(execGetNestedVariableByNameThreadSafe)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FMapProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ResultProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericGetNestedVariableByNameThreadSafe(Target, VarName, Success, ResultProperty, ResultAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result"))
+	static void GetNestedVariableByNameWithArguments(UObject* Target, FName VarName, const TArray<int32>& IntArguments,
+		const TArray<FName>& NameArguments, FAccessVariableParams Params, bool& Success, UProperty*& Result);
+
+	DECLARE_FUNCTION(execGetNestedVariableByNameWithArguments)
+	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_TARRAY_REF(int32, IntArguments);
+		P_GET_TARRAY_REF(FName, NameArguments);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FMapProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ResultProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		FVarAccessArguments Arguments;
+		Arguments.Integers = IntArguments;
+		Arguments.Names = NameArguments;
+		GenericGetNestedVariableByName(CallSite, Target, VarName, &Arguments, Success, ResultProperty, ResultAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	UFUNCTION(BlueprintPure, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result"))
+	static void GetNestedVariableByNameWithArgumentsPure(UObject* Target, FName VarName, const TArray<int32>& IntArguments,
+		const TArray<FName>& NameArguments, FAccessVariableParams Params, bool& Success, UProperty*& Result);
+
+	DECLARE_FUNCTION(execGetNestedVariableByNameWithArgumentsPure)
+	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_TARRAY_REF(int32, IntArguments);
+		P_GET_TARRAY_REF(FName, NameArguments);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FMapProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ResultProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		FVarAccessArguments Arguments;
+		Arguments.Integers = IntArguments;
+		Arguments.Names = NameArguments;
+		GenericGetNestedVariableByName(CallSite, Target, VarName, &Arguments, Success, ResultProperty, ResultAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result"))
+	static void GetNestedVariableByString(
+		UObject* Target, const FString& VarName, FAccessVariableParams Params, bool& Success, UProperty*& Result);
+
+	DECLARE_FUNCTION(execGetNestedVariableByString)
+	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FStrProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FMapProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ResultProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericGetNestedVariableByString(CallSite, Target, VarName, Success, ResultProperty, ResultAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	UFUNCTION(BlueprintPure, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result"))
+	static void GetNestedVariableByStringPure(
+		UObject* Target, const FString& VarName, FAccessVariableParams Params, bool& Success, UProperty*& Result);
+
+	DECLARE_FUNCTION(execGetNestedVariableByStringPure)
+	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FStrProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FMapProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ResultProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericGetNestedVariableByString(CallSite, Target, VarName, Success, ResultProperty, ResultAddr, Params);
 
 		P_NATIVE_END;
 	}
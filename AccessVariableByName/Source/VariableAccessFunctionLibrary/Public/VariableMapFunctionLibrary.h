@@ -0,0 +1,238 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+
+#include "VariableMapFunctionLibrary.generated.h"
+
+// Operate a map variable in place. Keys are looked up by the hash of the live map, so no copy of the whole map is made.
+UCLASS()
+class VARIABLEACCESSFUNCTIONLIBRARY_API UVariableMapFunctionLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	static bool GenericMapContainsByName(UObject* Target, FName VarName, bool& Success, FProperty* KeyProperty, void* KeyAddr,
+		const FAccessVariableParams& Params);
+	static void GenericMapAddByName(UObject* Target, FName VarName, bool& Success, FProperty* KeyProperty, void* KeyAddr,
+		FProperty* ValueProperty, void* ValueAddr, const FAccessVariableParams& Params);
+	static bool GenericMapRemoveByName(UObject* Target, FName VarName, bool& Success, FProperty* KeyProperty, void* KeyAddr,
+		const FAccessVariableParams& Params);
+	static int32 GenericMapRemoveKeysByName(UObject* Target, FName VarName, bool& Success, FArrayProperty* KeysProperty,
+		void* KeysAddr, const FAccessVariableParams& Params);
+	static void GenericMapKeysByName(UObject* Target, FName VarName, bool& Success, FArrayProperty* KeysProperty, void* KeysAddr,
+		const FAccessVariableParams& Params);
+	static void GenericMapValuesByName(UObject* Target, FName VarName, bool& Success, FArrayProperty* ValuesProperty,
+		void* ValuesAddr, const FAccessVariableParams& Params);
+	static void GenericMapGetPairByView(const FVarAccessContainerView& View, int32 PairIndex, bool& Success,
+		FProperty* KeyProperty, void* KeyAddr, FProperty* ValueProperty, void* ValueAddr);
+
+	// Resolve the map variable once for a loop, and return the upper bound of the internal index.
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly)
+	static int32 MapViewByName(
+		UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, FVarAccessContainerView& View);
+
+	// Copy the pair at the internal index of the map resolved by MapViewByName. Success will be false if the index is a hole.
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Key,Value"))
+	static void MapGetPairByView(
+		const FVarAccessContainerView& View, int32 PairIndex, bool& Success, UProperty*& Key, UProperty*& Value);
+
+	DECLARE_FUNCTION(execMapGetPairByView)
+	{
+		P_GET_STRUCT_REF(FVarAccessContainerView, View);
+		P_GET_PROPERTY(FIntProperty, PairIndex);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* KeyAddr = Stack.MostRecentPropertyAddress;
+		FProperty* KeyProperty = Stack.MostRecentProperty;
+
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* ValueAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ValueProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericMapGetPairByView(View, PairIndex, Success, KeyProperty, KeyAddr, ValueProperty, ValueAddr);
+
+		P_NATIVE_END;
+	}
+
+	// Return true if the map variable has the key.
+	UFUNCTION(BlueprintPure, CustomThunk, Category = "Access Variable by Name|Map",
+		meta = (DefaultToSelf = "Target", CustomStructureParam = "Key"))
+	static bool MapContainsByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* Key);
+
+	DECLARE_FUNCTION(execMapContainsByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* KeyAddr = Stack.MostRecentPropertyAddress;
+		FProperty* KeyProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		*(bool*) RESULT_PARAM = GenericMapContainsByName(Target, VarName, Success, KeyProperty, KeyAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Add the pair of key and value to the map variable. The value is replaced if the key already exists.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Map",
+		meta = (DefaultToSelf = "Target", CustomStructureParam = "Key,Value"))
+	static void MapAddByName(
+		UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* Key, UProperty* Value);
+
+	DECLARE_FUNCTION(execMapAddByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* KeyAddr = Stack.MostRecentPropertyAddress;
+		FProperty* KeyProperty = Stack.MostRecentProperty;
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* ValueAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ValueProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericMapAddByName(Target, VarName, Success, KeyProperty, KeyAddr, ValueProperty, ValueAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Remove the key from the map variable, and return true if the key was removed.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Map",
+		meta = (DefaultToSelf = "Target", CustomStructureParam = "Key"))
+	static bool MapRemoveByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, UProperty* Key);
+
+	DECLARE_FUNCTION(execMapRemoveByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* KeyAddr = Stack.MostRecentPropertyAddress;
+		FProperty* KeyProperty = Stack.MostRecentProperty;
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		*(bool*) RESULT_PARAM = GenericMapRemoveByName(Target, VarName, Success, KeyProperty, KeyAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Remove the given keys from the map variable, and return the number of the removed keys.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Access Variable by Name|Map",
+		meta = (DefaultToSelf = "Target", ArrayParm = "Keys"))
+	static int32 MapRemoveKeysByName(
+		UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, const TArray<int32>& Keys);
+
+	DECLARE_FUNCTION(execMapRemoveKeysByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* KeysAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* KeysProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		*(int32*) RESULT_PARAM = GenericMapRemoveKeysByName(Target, VarName, Success, KeysProperty, KeysAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Output all keys of the map variable.
+	UFUNCTION(BlueprintPure, CustomThunk, Category = "Access Variable by Name|Map",
+		meta = (DefaultToSelf = "Target", ArrayParm = "Keys"))
+	static void MapKeysByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, TArray<int32>& Keys);
+
+	DECLARE_FUNCTION(execMapKeysByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* KeysAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* KeysProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericMapKeysByName(Target, VarName, Success, KeysProperty, KeysAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Output all values of the map variable.
+	UFUNCTION(BlueprintPure, CustomThunk, Category = "Access Variable by Name|Map",
+		meta = (DefaultToSelf = "Target", ArrayParm = "Values"))
+	static void MapValuesByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success, TArray<int32>& Values);
+
+	DECLARE_FUNCTION(execMapValuesByName)
+	{
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ValuesAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ValuesProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericMapValuesByName(Target, VarName, Success, ValuesProperty, ValuesAddr, Params);
+
+		P_NATIVE_END;
+	}
+
+	// Return the number of pairs of the map variable.
+	UFUNCTION(BlueprintPure, Category = "Access Variable by Name|Map", meta = (DefaultToSelf = "Target"))
+	static int32 MapNumByName(UObject* Target, FName VarName, FAccessVariableParams Params, bool& Success);
+};
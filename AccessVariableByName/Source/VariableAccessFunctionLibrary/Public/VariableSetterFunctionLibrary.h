@@ -23,6 +23,15 @@ class VARIABLEACCESSFUNCTIONLIBRARY_API UVariableSetterFunctionLibarary : public
 public:
 	static void GenericSetNestedVariableByName(UObject* Target, FName VarName, bool& Success, FProperty* ResultProperty,
 		void* ResultAddr, FProperty* NewValueProperty, void* NewValueAddr, const FAccessVariableParams& Params);
+	static void GenericSetNestedVariableByName(const FVarAccessCallSiteKey& CallSite, UObject* Target, FName VarName,
+		const FVarAccessArguments* Arguments, bool& Success, FProperty* ResultProperty, void* ResultAddr,
+		FProperty* NewValueProperty, void* NewValueAddr, const FAccessVariableParams& Params);
+	static void GenericSetNestedVariableByString(UObject* Target, FStringView VarName, bool& Success,
+		FProperty* ResultProperty, void* ResultAddr, FProperty* NewValueProperty, void* NewValueAddr,
+		const FAccessVariableParams& Params);
+	static void GenericSetNestedVariableByString(const FVarAccessCallSiteKey& CallSite, UObject* Target, FStringView VarName,
+		bool& Success, FProperty* ResultProperty, void* ResultAddr, FProperty* NewValueProperty, void* NewValueAddr,
+		const FAccessVariableParams& Params);
 
 	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result,NewValue"))
 	static void SetNestedVariableByName(
@@ -30,6 +39,7 @@ public:
 
 	DECLARE_FUNCTION(execSetNestedVariableByName)
 	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
 		P_GET_OBJECT(UObject, Target);
 		P_GET_PROPERTY(FNameProperty, VarName);
 		P_GET_STRUCT(FAccessVariableParams, Params);
@@ -55,7 +65,88 @@ public:
 		P_NATIVE_BEGIN;
 
 		GenericSetNestedVariableByName(
-			Target, VarName, Success, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+			CallSite, Target, VarName, nullptr, Success, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+
+		P_NATIVE_END;
+		ResultProperty->DestroyValue(NewValueAddr);
+	}
+
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result,NewValue"))
+	static void SetNestedVariableByNameWithArguments(UObject* Target, FName VarName, const TArray<int32>& IntArguments,
+		const TArray<FName>& NameArguments, FAccessVariableParams Params, bool& Success, UProperty*& Result, UProperty* NewValue);
+
+	DECLARE_FUNCTION(execSetNestedVariableByNameWithArguments)
+	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FNameProperty, VarName);
+		P_GET_TARRAY_REF(int32, IntArguments);
+		P_GET_TARRAY_REF(FName, NameArguments);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ResultProperty = Stack.MostRecentProperty;
+
+#if !UE_VERSION_OLDER_THAN(5, 5, 0)
+		int32 PropertySize = ResultProperty->GetElementSize() * ResultProperty->ArrayDim;
+#else
+		int32 PropertySize = ResultProperty->ElementSize * ResultProperty->ArrayDim;
+#endif
+		void* NewValueAddr = FMemory_Alloca(PropertySize);
+		ResultProperty->InitializeValue(NewValueAddr);
+		Stack.MostRecentPropertyAddress = NULL;
+		Stack.StepCompiledIn<FProperty>(NewValueAddr);
+		FProperty* NewValueProperty = Stack.MostRecentProperty;
+
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		FVarAccessArguments Arguments;
+		Arguments.Integers = IntArguments;
+		Arguments.Names = NameArguments;
+		GenericSetNestedVariableByName(
+			CallSite, Target, VarName, &Arguments, Success, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
+
+		P_NATIVE_END;
+		ResultProperty->DestroyValue(NewValueAddr);
+	}
+
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Result,NewValue"))
+	static void SetNestedVariableByString(UObject* Target, const FString& VarName, FAccessVariableParams Params, bool& Success,
+		UProperty*& Result, UProperty* NewValue);
+
+	DECLARE_FUNCTION(execSetNestedVariableByString)
+	{
+		const FVarAccessCallSiteKey CallSite = FVariableAccessFunctionLibraryUtils::MakeCallSiteKey(Stack);
+		P_GET_OBJECT(UObject, Target);
+		P_GET_PROPERTY(FStrProperty, VarName);
+		P_GET_STRUCT(FAccessVariableParams, Params);
+		P_GET_PROPERTY_REF(FBoolProperty, Success);
+
+		Stack.StepCompiledIn<FProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FProperty* ResultProperty = Stack.MostRecentProperty;
+
+#if !UE_VERSION_OLDER_THAN(5, 5, 0)
+		int32 PropertySize = ResultProperty->GetElementSize() * ResultProperty->ArrayDim;
+#else
+		int32 PropertySize = ResultProperty->ElementSize * ResultProperty->ArrayDim;
+#endif
+		void* NewValueAddr = FMemory_Alloca(PropertySize);
+		ResultProperty->InitializeValue(NewValueAddr);
+		Stack.MostRecentPropertyAddress = NULL;
+		Stack.StepCompiledIn<FProperty>(NewValueAddr);
+		FProperty* NewValueProperty = Stack.MostRecentProperty;
+
+		P_FINISH;
+
+		P_NATIVE_BEGIN;
+
+		GenericSetNestedVariableByString(
+			CallSite, Target, VarName, Success, ResultProperty, ResultAddr, NewValueProperty, NewValueAddr, Params);
 
 		P_NATIVE_END;
 		ResultProperty->DestroyValue(NewValueAddr);
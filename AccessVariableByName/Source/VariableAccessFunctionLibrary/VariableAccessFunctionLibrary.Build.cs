@@ -21,7 +21,9 @@ public class VariableAccessFunctionLibrary : ModuleRules
 			"Engine",
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[]{});
+		PrivateDependencyModuleNames.AddRange(new string[]{
+			"PropertyPath",
+		});
 
 		// @remove-start FULL_VERSION=true
 		PublicDefinitions.Add("AVBN_FREE_VERSION");
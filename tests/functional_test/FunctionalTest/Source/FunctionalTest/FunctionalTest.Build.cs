@@ -8,10 +8,17 @@ public class FunctionalTest : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
-		PublicDependencyModuleNames.AddRange(new string[]{"Core", "CoreUObject", "Engine", "InputCore"});
+		PublicDependencyModuleNames.AddRange(
+			new string[]{"Core", "CoreUObject", "Engine", "InputCore", "PropertyPath", "VariableAccessFunctionLibrary"});
 
 		PrivateDependencyModuleNames.AddRange(new string[]{});
 
+		// The tests of the nodes and the compile-time checks use the editor modules.
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.AddRange(new string[]{"AccessVariableByName", "BlueprintGraph", "UnrealEd"});
+		}
+
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
 
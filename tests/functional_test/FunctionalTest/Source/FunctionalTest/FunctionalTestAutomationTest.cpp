@@ -1,8 +1,43 @@
+#include "Async/Async.h"
 #include "Engine/Blueprint.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "FunctionalTestTypes.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/MemoryBase.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "PropertyPathHelpers.h"
+#include "VariableAccessAsync.h"
+#include "VariableAccessFunctionLibraryUtils.h"
+#include "VariableAccessJobSubsystem.h"
+#include "VariableAccessNativeAccessors.h"
+#include "VariableAccessPropertyPath.h"
+#include "VariableAccessSnapshot.h"
+#include "VariableAccessThreadSafe.h"
+#include "VariableAccessWriteBuffer.h"
+#include "VariableAccessor.h"
+#include "VariableArrayFunctionLibrary.h"
+#include "VariableBulkAccessFunctionLibrary.h"
+#include "VariableGetterFunctionLibrary.h"
+#include "VariableMapFunctionLibrary.h"
+#include "VariableSetterFunctionLibrary.h"
+
+#include <atomic>
+
+#if WITH_EDITOR
+#include "AccessVariableByNameUtils.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/UserDefinedStruct.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_ForEachElementByName.h"
+#include "K2Node_FunctionEntry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/StructureEditorUtils.h"
+#endif
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFuntionalTestGetVariableByName, "AccessVariableByName.FunctionalTest.GetVariableByName",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
@@ -14,6 +49,54 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFuntionalTestSetVariableByName, "AccessVariabl
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFuntionalTestSetVariableByNameDynamic,
 	"AccessVariableByName.FunctionalTest.SetVariableByNameDynamic",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBenchmarkDynamicNodeBytecode, "AccessVariableByName.Benchmark.DynamicNodeBytecode",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestHotPathAllocations, "AccessVariableByName.FunctionalTest.HotPathAllocations",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestVariableAccessor, "AccessVariableByName.FunctionalTest.VariableAccessor",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestPropertyPathInterop, "AccessVariableByName.FunctionalTest.PropertyPathInterop",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBenchmarkCachedPropertyPath, "AccessVariableByName.Benchmark.CachedPropertyPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestNativeAccessors, "AccessVariableByName.FunctionalTest.NativeAccessors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBenchmarkParseCacheScaling, "AccessVariableByName.Benchmark.ParseCacheScaling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestThreadSafeRead, "AccessVariableByName.FunctionalTest.ThreadSafeRead",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestThreadSafeGetter, "AccessVariableByName.FunctionalTest.ThreadSafeGetter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestSnapshot, "AccessVariableByName.FunctionalTest.Snapshot",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestArrayByName, "AccessVariableByName.FunctionalTest.ArrayByName",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestMapByName, "AccessVariableByName.FunctionalTest.MapByName",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestForEachElementByName, "AccessVariableByName.FunctionalTest.ForEachElementByName",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestAccessJobs, "AccessVariableByName.FunctionalTest.AccessJobs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestBulkAccess, "AccessVariableByName.FunctionalTest.BulkAccess",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestCallSiteCache, "AccessVariableByName.FunctionalTest.CallSiteCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestPathArguments, "AccessVariableByName.FunctionalTest.PathArguments",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestVariableByString, "AccessVariableByName.FunctionalTest.VariableByString",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestObjectChain, "AccessVariableByName.FunctionalTest.ObjectChain",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestAsyncAccess, "AccessVariableByName.FunctionalTest.AsyncAccess",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestWriteBuffer, "AccessVariableByName.FunctionalTest.WriteBuffer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestMissingVariableCache, "AccessVariableByName.FunctionalTest.MissingVariableCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestUserDefinedStruct, "AccessVariableByName.FunctionalTest.UserDefinedStruct",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionalTestClassPropertyTable, "AccessVariableByName.FunctionalTest.ClassPropertyTable",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter);
 
 bool TestCommon(FAutomationTestBase* AuctionmationTest, UBlueprint* Blueprint)
 {
@@ -73,3 +156,1935 @@ bool FFuntionalTestSetVariableByNameDynamic::RunTest(const FString& Parameters)
 
 	return TestCommon(this, Blueprint);
 }
+
+int32 CountFunctionCalls(const UFunction* Function, const UFunction* Callee)
+{
+	// The called function is embedded as a pointer in the bytecode.
+	const TArray<uint8>& Script = Function->Script;
+	int32 Count = 0;
+	for (int32 Index = 0; Index + (int32) sizeof(Callee) <= Script.Num(); ++Index)
+	{
+		if (FMemory::Memcmp(&Script[Index], &Callee, sizeof(Callee)) == 0)
+		{
+			++Count;
+		}
+	}
+
+	return Count;
+}
+
+// Bytecode size of the functions declared by the class, and the number of the calls to the function in them.
+TTuple<int32, int32> MeasureBytecode(const UClass* Class, const UFunction* Callee)
+{
+	int32 ScriptSize = 0;
+	int32 NumCalls = 0;
+	for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		ScriptSize += It->Script.Num();
+		NumCalls += CountFunctionCalls(*It, Callee);
+	}
+
+	return TTuple<int32, int32>(ScriptSize, NumCalls);
+}
+
+bool FBenchmarkDynamicNodeBytecode::RunTest(const FString& Parameters)
+{
+#if WITH_EDITOR
+	UFunction* MakeParamsFunction = FindObject<UFunction>(
+		nullptr, TEXT("/Script/VariableAccessFunctionLibrary.VariableAccessUtilLibrary:MakeAccessVariableParams"));
+	TestNotNull(TEXT("MakeAccessVariableParams should not be null"), MakeParamsFunction);
+	if (MakeParamsFunction == nullptr)
+	{
+		return false;
+	}
+
+	const TCHAR* BlueprintPaths[] = {
+		TEXT("/Game/FunctionalTest/GetVariableByNameDynamic.GetVariableByNameDynamic"),
+		TEXT("/Game/FunctionalTest/SetVariableByNameDynamic.SetVariableByNameDynamic"),
+	};
+	for (const TCHAR* BlueprintPath : BlueprintPaths)
+	{
+		UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, BlueprintPath);
+		TestNotNull(TEXT("Blueprint should not be null"), Blueprint);
+		if (Blueprint == nullptr)
+		{
+			continue;
+		}
+
+		// Compile with the current nodes, since the loaded bytecode may be saved by a previous version.
+		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		const TTuple<int32, int32> Bytecode = MeasureBytecode(Blueprint->GeneratedClass, MakeParamsFunction);
+
+		AddInfo(FString::Format(TEXT("'{0}': bytecode size = {1} bytes, MakeAccessVariableParams calls = {2}"),
+			{BlueprintPath, Bytecode.Get<0>(), Bytecode.Get<1>()}));
+		TestEqual(TEXT("Parameters should be passed as a literal"), Bytecode.Get<1>(), 0);
+	}
+#endif
+
+	return true;
+}
+
+double MeasureParseThroughput(int32 NumThreads, const TArray<FString>& VarNames, int32 NumParsesPerThread)
+{
+	std::atomic<bool> bStart(false);
+	TArray<TFuture<void>> Futures;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		Futures.Add(Async(EAsyncExecution::Thread,
+			[&bStart, &VarNames, NumParsesPerThread, ThreadIndex]()
+			{
+				while (!bStart.load())
+				{
+					FPlatformProcess::Yield();
+				}
+				TArray<FVarDescription> VarDescs;
+				for (int32 Index = 0; Index < NumParsesPerThread; ++Index)
+				{
+					FVariableAccessFunctionLibraryUtils::ParseVarName(
+						VarNames[(Index + ThreadIndex) % VarNames.Num()], &VarDescs);
+				}
+			}));
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	bStart = true;
+	for (TFuture<void>& Future : Futures)
+	{
+		Future.Wait();
+	}
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+	return NumThreads * NumParsesPerThread / FMath::Max(Elapsed, SMALL_NUMBER);
+}
+
+bool IsSameVarDescs(const TArray<FVarDescription>& A, const TArray<FVarDescription>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < A.Num(); ++Index)
+	{
+		if (A[Index].bIsValid != B[Index].bIsValid || A[Index].Name != B[Index].Name ||
+			A[Index].ArrayAccessType != B[Index].ArrayAccessType ||
+			A[Index].ArrayAccessValue.Integer != B[Index].ArrayAccessValue.Integer ||
+			A[Index].ArrayAccessValue.String != B[Index].ArrayAccessValue.String ||
+			A[Index].ArgumentIndex != B[Index].ArgumentIndex)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FBenchmarkParseCacheScaling::RunTest(const FString& Parameters)
+{
+	const int32 NumParsesPerThread = 200000;
+	const int32 ThreadCounts[] = {1, 2, 4, 8, 16, 32};
+
+	TArray<FString> VarNames;
+	for (int32 Index = 0; Index < 48; ++Index)
+	{
+		VarNames.Add(FString::Printf(TEXT("Inventory.Slots[%d].Item.Stats.Value%d"), Index % 8, Index));
+	}
+
+	double SingleThroughput = 0.0;
+	for (int32 NumThreads : ThreadCounts)
+	{
+		FVariableAccessFunctionLibraryUtils::ResetParseCacheStats();
+		const double Throughput = MeasureParseThroughput(NumThreads, VarNames, NumParsesPerThread);
+		if (NumThreads == 1)
+		{
+			SingleThroughput = Throughput;
+		}
+		const FVarAccessCacheStats Stats = FVariableAccessFunctionLibraryUtils::GetParseCacheStats();
+
+		AddInfo(FString::Printf(TEXT("%2d threads: %.2f M parses/s, scaling = %.2f, "
+									 "L1 hits = %llu, shared hits = %llu, misses = %llu, contended = %llu"),
+			NumThreads, Throughput / 1e6, Throughput / FMath::Max(SingleThroughput * NumThreads, SMALL_NUMBER), Stats.L1Hits,
+			Stats.SharedHits, Stats.Misses, Stats.ContendedLocks));
+	}
+
+	// The repeated lookups of the same path hit the per-thread cache.
+	const int32 NumRepeats = 1000;
+	TArray<FVarDescription> VarDescs;
+	FVariableAccessFunctionLibraryUtils::ParseVarName(VarNames[0], &VarDescs);
+	FVariableAccessFunctionLibraryUtils::ResetParseCacheStats();
+	for (int32 Index = 0; Index < NumRepeats; ++Index)
+	{
+		FVariableAccessFunctionLibraryUtils::ParseVarName(VarNames[0], &VarDescs);
+	}
+	const FVarAccessCacheStats RepeatStats = FVariableAccessFunctionLibraryUtils::GetParseCacheStats();
+	TestTrue(TEXT("The repeated lookups should hit the per-thread cache"), RepeatStats.L1Hits > 0);
+	TestEqual(TEXT("The repeated lookups should not parse the path again"), RepeatStats.Misses, (uint64)0);
+
+	// The paths parsed by many threads at once are the same as the ones parsed by a single thread.
+	// The paths are new to the cache, so that the threads race to add them.
+	const int32 NumThreads = 16;
+	TArray<FString> NewVarNames;
+	TArray<TArray<FVarDescription>> Expected;
+	for (int32 Index = 0; Index < 64; ++Index)
+	{
+		NewVarNames.Add(FString::Printf(TEXT("Scaling%d.Slots[%d].Tags[Name%d]"), Index, Index % 8, Index));
+		TArray<FString> Segments;
+		FVariableAccessFunctionLibraryUtils::SplitVarName(NewVarNames.Last(), &Segments);
+		FVariableAccessFunctionLibraryUtils::AnalyzeVarNames(Segments, &Expected.AddDefaulted_GetRef());
+	}
+	std::atomic<int32> NumMismatches(0);
+	std::atomic<bool> bStart(false);
+	TArray<TFuture<void>> Futures;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		Futures.Add(Async(EAsyncExecution::Thread,
+			[&bStart, &NumMismatches, &NewVarNames, &Expected, ThreadIndex]()
+			{
+				while (!bStart.load())
+				{
+					FPlatformProcess::Yield();
+				}
+				TArray<FVarDescription> ThreadVarDescs;
+				for (int32 Index = 0; Index < NewVarNames.Num() * 4; ++Index)
+				{
+					const int32 NameIndex = (Index + ThreadIndex) % NewVarNames.Num();
+					FVariableAccessFunctionLibraryUtils::ParseVarName(NewVarNames[NameIndex], &ThreadVarDescs);
+					if (!IsSameVarDescs(ThreadVarDescs, Expected[NameIndex]))
+					{
+						++NumMismatches;
+					}
+				}
+			}));
+	}
+	bStart = true;
+	for (TFuture<void>& Future : Futures)
+	{
+		Future.Wait();
+	}
+	TestEqual(TEXT("The paths parsed by the threads should be the same as the single-threaded result"), NumMismatches.load(), 0);
+
+	return true;
+}
+
+// Counts the heap allocations made by the thread which installed it.
+// It is never destroyed, since other threads may still be calling it after it is uninstalled.
+class FAllocationCounter : public FMalloc
+{
+public:
+	static FAllocationCounter& Get()
+	{
+		static FAllocationCounter* Counter = new FAllocationCounter();
+		return *Counter;
+	}
+
+	void Install()
+	{
+		InnerMalloc = GMalloc;
+		ThreadId = FPlatformTLS::GetCurrentThreadId();
+		NumAllocations = 0;
+		GMalloc = this;
+	}
+
+	void Uninstall()
+	{
+		GMalloc = InnerMalloc;
+	}
+
+	int32 GetNumAllocations() const
+	{
+		return NumAllocations.load();
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override
+	{
+		InnerMalloc->Free(Original);
+	}
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{
+		return InnerMalloc->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		return InnerMalloc->QuantizeSize(Count, Alignment);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return InnerMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		return TEXT("AllocationCounter");
+	}
+
+private:
+	void CountAllocation()
+	{
+		if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+		{
+			++NumAllocations;
+		}
+	}
+
+	FMalloc* InnerMalloc = nullptr;
+	uint32 ThreadId = 0;
+	std::atomic<int32> NumAllocations{0};
+};
+
+bool FFunctionalTestHotPathAllocations::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+
+	// Scalar terminals on the object and in a structure of the object.
+	FProperty* LifeSpanProperty = FindFProperty<FProperty>(AActor::StaticClass(), TEXT("InitialLifeSpan"));
+	FProperty* TickIntervalProperty = FindFProperty<FProperty>(FTickFunction::StaticStruct(), TEXT("TickInterval"));
+	TestNotNull(TEXT("InitialLifeSpan should be found"), LifeSpanProperty);
+	TestNotNull(TEXT("TickInterval should be found"), TickIntervalProperty);
+	if (LifeSpanProperty == nullptr || TickIntervalProperty == nullptr)
+	{
+		return false;
+	}
+
+	const FAccessVariableParams Params;
+	const FName LifeSpanName(TEXT("InitialLifeSpan"));
+	const FName TickIntervalName(TEXT("PrimaryActorTick.TickInterval"));
+	float Value = 0.0f;
+	float NewValue = 2.0f;
+	int32 NumSucceeded = 0;
+	auto Access = [&]()
+	{
+		bool bSuccess = false;
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+			Actor, LifeSpanName, bSuccess, LifeSpanProperty, &Value, Params);
+		NumSucceeded += bSuccess ? 1 : 0;
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+			Actor, TickIntervalName, bSuccess, TickIntervalProperty, &Value, Params);
+		NumSucceeded += bSuccess ? 1 : 0;
+		UVariableSetterFunctionLibarary::GenericSetNestedVariableByName(
+			Actor, LifeSpanName, bSuccess, LifeSpanProperty, &Value, LifeSpanProperty, &NewValue, Params);
+		NumSucceeded += bSuccess ? 1 : 0;
+		UVariableSetterFunctionLibarary::GenericSetNestedVariableByName(
+			Actor, TickIntervalName, bSuccess, TickIntervalProperty, &Value, TickIntervalProperty, &NewValue, Params);
+		NumSucceeded += bSuccess ? 1 : 0;
+	};
+
+	// The first access parses the paths and resolves the properties.
+	Access();
+	TestEqual(TEXT("All accesses should succeed"), NumSucceeded, 4);
+
+	const int32 NumRepeats = 100;
+	FAllocationCounter& Counter = FAllocationCounter::Get();
+	Counter.Install();
+	for (int32 Index = 0; Index < NumRepeats; ++Index)
+	{
+		Access();
+	}
+	Counter.Uninstall();
+
+	AddInfo(FString::Printf(TEXT("%d accesses: %d allocations"), NumRepeats * 4, Counter.GetNumAllocations()));
+	TestEqual(TEXT("All accesses should succeed"), NumSucceeded, 4 * (NumRepeats + 1));
+	TestEqual(TEXT("Repeated accesses should not allocate"), Counter.GetNumAllocations(), 0);
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestVariableAccessor::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+
+	const TVariableAccessor<float> LifeSpan(TEXT("InitialLifeSpan"));
+	const TVariableAccessor<float> TickInterval(TEXT("PrimaryActorTick.TickInterval"));
+	TestTrue(TEXT("The path should be valid"), LifeSpan.IsValid() && TickInterval.IsValid());
+
+	TestTrue(TEXT("The variable should be set"), LifeSpan.Set(Actor, 3.0f));
+	TestEqual(TEXT("The variable should be read"), LifeSpan.Get(Actor).Get(0.0f), 3.0f);
+	TestTrue(TEXT("The nested variable should be set"), TickInterval.Set(Actor, 0.5f));
+	TestEqual(TEXT("The nested variable should be read"), TickInterval.Get(Actor).Get(0.0f), 0.5f);
+
+	// The type of the variable is checked against T.
+	const TVariableAccessor<int32> WrongType(TEXT("InitialLifeSpan"));
+	TestFalse(TEXT("The variable of another type should not be read"), WrongType.Get(Actor).IsSet());
+	TestFalse(TEXT("The variable of another type should not be set"), WrongType.Set(Actor, 1));
+
+	// The path parsed at compile time.
+	static constexpr auto TickIntervalPath = VAR_ACCESS_STATIC_PATH(TEXT("PrimaryActorTick.TickInterval"));
+	const TVariableAccessor<float> StaticTickInterval(TickIntervalPath);
+	TestTrue(TEXT("The static path should be valid"), StaticTickInterval.IsValid());
+	TestEqual(TEXT("The variable should be read by the static path"), StaticTickInterval.Get(Actor).Get(0.0f), 0.5f);
+
+	const TVariableAccessor<float> Missing(TEXT("NotExist"));
+	TestFalse(TEXT("The missing variable should not be read"), Missing.Get(Actor).IsSet());
+	const TVariableAccessor<float> Malformed(TEXT("Initial-LifeSpan"));
+	TestFalse(TEXT("The malformed path should be invalid"), Malformed.IsValid());
+	TestFalse(TEXT("The null object should not be read"), LifeSpan.Get(nullptr).IsSet());
+
+	// The resolved chain is reused on the repeated access.
+	const int32 NumRepeats = 100;
+	int32 NumSucceeded = 0;
+	FAllocationCounter& Counter = FAllocationCounter::Get();
+	Counter.Install();
+	for (int32 Index = 0; Index < NumRepeats; ++Index)
+	{
+		NumSucceeded += LifeSpan.Get(Actor).IsSet() ? 1 : 0;
+		NumSucceeded += TickInterval.Set(Actor, 0.25f) ? 1 : 0;
+	}
+	Counter.Uninstall();
+
+	TestEqual(TEXT("All accesses should succeed"), NumSucceeded, NumRepeats * 2);
+	TestEqual(TEXT("Repeated accesses should not allocate"), Counter.GetNumAllocations(), 0);
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestPropertyPathInterop::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+	Actor->PrimaryActorTick.TickInterval = 0.75f;
+
+	FCachedPropertyPath TickIntervalPath;
+	TestTrue(TEXT("The path should be converted"),
+		FVariableAccessPropertyPath::ToCachedPropertyPath(TEXT("PrimaryActorTick.TickInterval"), &TickIntervalPath));
+	TestEqual(TEXT("The engine path should have 2 segments"), TickIntervalPath.GetNumSegments(), 2);
+	float TickInterval = 0.0f;
+	TestTrue(TEXT("The engine should read the converted path"),
+		PropertyPathHelpers::GetPropertyValue(Actor, TickIntervalPath, TickInterval));
+	TestEqual(TEXT("The engine should read the same value"), TickInterval, 0.75f);
+
+	// The placeholders are substituted before the conversion.
+	const int32 Indices[] = {3};
+	FVarAccessArguments Arguments;
+	Arguments.Integers = Indices;
+	FCachedPropertyPath ItemPath;
+	TestTrue(TEXT("The path with the argument should be converted"),
+		FVariableAccessPropertyPath::ToCachedPropertyPath(TEXT("Items[{0}].Count"), &ItemPath, Arguments));
+	TestEqual(TEXT("The argument should be the array index"), ItemPath.GetSegment(0).GetArrayIndex(), 3);
+	TestFalse(TEXT("The placeholder without the argument should not be converted"),
+		FVariableAccessPropertyPath::ToCachedPropertyPath(TEXT("Items[{0}].Count"), &ItemPath));
+	TestFalse(TEXT("The map key should not be converted"),
+		FVariableAccessPropertyPath::ToCachedPropertyPath(TEXT("Tags[\"Rare\"]"), &ItemPath));
+
+	TArray<FVarDescription> VarDescs;
+	TestTrue(TEXT("The engine path should be converted"),
+		FVariableAccessPropertyPath::FromCachedPropertyPath(FCachedPropertyPath(TEXT("Items[2].Count")), &VarDescs));
+	TestEqual(TEXT("The engine path should have 2 descriptions"), VarDescs.Num(), 2);
+	TestEqual(TEXT("The variable path should be restored"), FVariableAccessPropertyPath::ToVarName(VarDescs),
+		FString(TEXT("Items[2].Count")));
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FBenchmarkCachedPropertyPath::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+
+	const int32 NumGets = 100000;
+	const TCHAR* VarNames[] = {TEXT("InitialLifeSpan"), TEXT("PrimaryActorTick.TickInterval")};
+	for (const TCHAR* VarName : VarNames)
+	{
+		FCachedPropertyPath EnginePath;
+		TestTrue(TEXT("The path should be converted"), FVariableAccessPropertyPath::ToCachedPropertyPath(VarName, &EnginePath));
+		const TVariableAccessor<float> Accessor(VarName);
+		const FName Name(VarName);
+		// Any float property describes the type of the value.
+		FProperty* ValueProperty = FindFProperty<FProperty>(AActor::StaticClass(), TEXT("InitialLifeSpan"));
+
+		float Value = 0.0f;
+		float Sum = 0.0f;
+		// The first access resolves the paths.
+		PropertyPathHelpers::GetPropertyValue(Actor, EnginePath, Value);
+		Accessor.Get(Actor);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumGets; ++Index)
+		{
+			PropertyPathHelpers::GetPropertyValue(Actor, EnginePath, Value);
+			Sum += Value;
+		}
+		const double EngineTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumGets; ++Index)
+		{
+			Sum += Accessor.Get(Actor).Get(0.0f);
+		}
+		const double AccessorTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumGets; ++Index)
+		{
+			bool bSuccess = false;
+			UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+				Actor, Name, bSuccess, ValueProperty, &Value, FAccessVariableParams());
+			Sum += Value;
+		}
+		const double GenericTime = FPlatformTime::Seconds() - StartTime;
+
+		AddInfo(FString::Printf(TEXT("'%s': FCachedPropertyPath %.1f ns, TVariableAccessor %.1f ns, "
+									 "GenericGetNestedVariableByName %.1f ns (sum %f)"),
+			VarName, EngineTime * 1.0e9 / NumGets, AccessorTime * 1.0e9 / NumGets, GenericTime * 1.0e9 / NumGets, Sum));
+	}
+
+	Actor->Destroy();
+
+	return true;
+}
+
+// Same as the accessor generated by the GenerateNativeAccessors commandlet, which counts the reads.
+int32 NumNativeTickIntervalReads = 0;
+
+const float& GetTickInterval(const UObject* Target)
+{
+	++NumNativeTickIntervalReads;
+	return static_cast<const AActor*>(Target)->PrimaryActorTick.TickInterval;
+}
+
+void SetTickInterval(UObject* Target, const float& Value)
+{
+	static_cast<AActor*>(Target)->PrimaryActorTick.TickInterval = Value;
+}
+
+bool FFunctionalTestNativeAccessors::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+	Actor->PrimaryActorTick.TickInterval = 0.25f;
+
+	FProperty* TickIntervalProperty = FindFProperty<FProperty>(FTickFunction::StaticStruct(), TEXT("TickInterval"));
+	const FName TickIntervalName(TEXT("PrimaryActorTick.TickInterval"));
+	const FName TickGroupName(TEXT("PrimaryActorTick.TickGroup"));
+	const FAccessVariableParams Params;
+	const int32 NumGets = 100000;
+	float Value = 0.0f;
+	float NewValue = 0.5f;
+	float Sum = 0.0f;
+	bool bSuccess = false;
+	double NativeTime = 0.0;
+
+	{
+		// The second accessor returns the address of another member, which the verification refuses.
+		const FVarAccessNativeAccessor Accessors[] = {
+			MakeVarAccessNativeAccessor<float, &GetTickInterval, &SetTickInterval>(
+				&AActor::StaticClass, TEXT("PrimaryActorTick.TickInterval")),
+			MakeVarAccessNativeAccessor<float, &GetTickInterval, &SetTickInterval>(
+				&AActor::StaticClass, TEXT("PrimaryActorTick.TickGroup")),
+		};
+		FVarAccessNativeAccessorRegistration Registration(Accessors);
+		FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+
+		const FVarAccessNativeBinding* Binding = FVariableAccessNativeAccessors::Find(APawn::StaticClass(), TickIntervalName);
+		TestNotNull(TEXT("The accessor should be found from the subclass"), Binding);
+		TestNull(TEXT("The accessor which does not match the reflection should not be used"),
+			FVariableAccessNativeAccessors::Find(AActor::StaticClass(), TickGroupName));
+		if (Binding != nullptr)
+		{
+			TestTrue(TEXT("The accessor should not apply to the other class"),
+				FVariableAccessNativeAccessors::Resolve(*Binding, World, nullptr).Get<0>() == nullptr);
+		}
+
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+			Actor, TickIntervalName, bSuccess, TickIntervalProperty, &Value, Params);
+		TestTrue(TEXT("The variable should be got through the accessor"), bSuccess);
+		TestEqual(TEXT("The value got through the accessor should be correct"), Value, 0.25f);
+		UVariableSetterFunctionLibarary::GenericSetNestedVariableByName(
+			Actor, TickIntervalName, bSuccess, TickIntervalProperty, &Value, TickIntervalProperty, &NewValue, Params);
+		TestTrue(TEXT("The variable should be set through the accessor"), bSuccess);
+		TestEqual(TEXT("The value set through the accessor should be correct"), Actor->PrimaryActorTick.TickInterval, 0.5f);
+
+		// Every access is dispatched to the typed function instead of copying through the property.
+		NumNativeTickIntervalReads = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumGets; ++Index)
+		{
+			UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+				Actor, TickIntervalName, bSuccess, TickIntervalProperty, &Value, Params);
+			Sum += Value;
+		}
+		NativeTime = FPlatformTime::Seconds() - StartTime;
+		TestEqual(TEXT("Every get should call the native accessor"), NumNativeTickIntervalReads, NumGets);
+
+		// The string path which is not a name yet is looked up without adding it to the name table.
+		const TCHAR* NewPath = TEXT("PrimaryActorTick.NativeAccessorsTestMissing");
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(
+			Actor, NewPath, bSuccess, TickIntervalProperty, &Value, Params);
+		TestTrue(TEXT("The string path should not be added to the name table"), FName(NewPath, FNAME_Find).IsNone());
+	}
+
+	// The chains still refer to the binding of the unregistered accessor, and fall back to the reflection.
+	TestNull(TEXT("The unregistered accessor should not be found"),
+		FVariableAccessNativeAccessors::Find(AActor::StaticClass(), TickIntervalName));
+	NumNativeTickIntervalReads = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumGets; ++Index)
+	{
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+			Actor, TickIntervalName, bSuccess, TickIntervalProperty, &Value, Params);
+		Sum += Value;
+	}
+	const double ReflectionTime = FPlatformTime::Seconds() - StartTime;
+	TestTrue(TEXT("The variable should be got without the accessor"), bSuccess);
+	TestEqual(TEXT("The value got without the accessor should be correct"), Value, 0.5f);
+	TestEqual(TEXT("The unregistered accessor should not be called"), NumNativeTickIntervalReads, 0);
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+
+	AddInfo(FString::Printf(TEXT("'PrimaryActorTick.TickInterval': native accessor %.1f ns, reflection %.1f ns (sum %f)"),
+		NativeTime * 1.0e9 / NumGets, ReflectionTime * 1.0e9 / NumGets, Sum));
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestThreadSafeRead::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+	Actor->PrimaryActorTick.TickInterval = 0.25f;
+	Actor->Tags.Add(TEXT("ThreadSafeTag"));
+
+	const FName TickIntervalName(TEXT("PrimaryActorTick.TickInterval"));
+	const FName TagName(TEXT("Tags[0]"));
+
+	// The variable is read from a worker thread.
+	TFuture<TOptional<float>> WorkerValue = Async(EAsyncExecution::Thread,
+		[Actor, TickIntervalName]() { return FVariableAccessThreadSafe::GetNestedVariableByName<float>(Actor, TickIntervalName); });
+	TestEqual(TEXT("The variable should be read from the worker thread"), WorkerValue.Get().Get(0.0f), 0.25f);
+
+	// The path which accesses a container element is refused without the container lock.
+	TestFalse(TEXT("The container element should not be read without the lock"),
+		FVariableAccessThreadSafe::GetNestedVariableByName<FName>(Actor, TagName).IsSet());
+	{
+		FVariableAccessThreadSafe::FContainerReadScope ContainerReadScope;
+		TestTrue(TEXT("The container element should be read with the lock"),
+			FVariableAccessThreadSafe::GetNestedVariableByName<FName>(Actor, TagName, FAccessVariableParams(), &ContainerReadScope)
+				.Get(NAME_None) == TEXT("ThreadSafeTag"));
+	}
+
+	// The caches are invalidated while a worker thread keeps reading.
+	std::atomic<bool> bStop(false);
+	std::atomic<int32> NumFailed(0);
+	TFuture<void> Reader = Async(EAsyncExecution::Thread,
+		[Actor, TickIntervalName, &bStop, &NumFailed]()
+		{
+			while (!bStop.load())
+			{
+				if (!FVariableAccessThreadSafe::GetNestedVariableByName<float>(Actor, TickIntervalName).IsSet())
+				{
+					++NumFailed;
+				}
+			}
+		});
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+		FPlatformProcess::Sleep(0.0f);
+	}
+	bStop = true;
+	Reader.Wait();
+	TestEqual(TEXT("The reads during the invalidation should succeed"), NumFailed.load(), 0);
+
+	// The tables retired while the reader was running are deleted once no reader is running.
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+	TestEqual(TEXT("The retired tables should be deleted"), FVariableAccessThreadSafe::GetNumRetiredTables(), 0);
+
+	// The live table does not keep the stale entries, so the repeated read after the invalidation does not build the chain.
+	FVariableAccessThreadSafe::GetNestedVariableByName<float>(Actor, TickIntervalName);
+	const int32 NumRepeats = 100;
+	int32 NumSucceeded = 0;
+	FAllocationCounter& Counter = FAllocationCounter::Get();
+	Counter.Install();
+	for (int32 Index = 0; Index < NumRepeats; ++Index)
+	{
+		NumSucceeded += FVariableAccessThreadSafe::GetNestedVariableByName<float>(Actor, TickIntervalName).IsSet() ? 1 : 0;
+	}
+	Counter.Uninstall();
+
+	TestEqual(TEXT("All reads should succeed"), NumSucceeded, NumRepeats);
+	TestEqual(TEXT("Repeated reads after the invalidation should not allocate"), Counter.GetNumAllocations(), 0);
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestThreadSafeGetter::RunTest(const FString& Parameters)
+{
+	UFunctionalTestAnimInstance* AnimInstance = NewObject<UFunctionalTestAnimInstance>();
+	AnimInstance->BoneSettings.Damping = 0.5f;
+	AnimInstance->BoneSettingsList.AddDefaulted();
+	AnimInstance->LinkedInstance = AnimInstance;
+
+	FProperty* DampingProperty = FindFProperty<FProperty>(FFunctionalTestBoneSettings::StaticStruct(), TEXT("Damping"));
+	TestNotNull(TEXT("Damping should be found"), DampingProperty);
+	if (DampingProperty == nullptr)
+	{
+		return false;
+	}
+
+	const FName DampingName(TEXT("BoneSettings.Damping"));
+	const FAccessVariableParams Params;
+	auto Get = [AnimInstance, DampingProperty, &Params](FName VarName, float& Value)
+	{
+		bool bSuccess = false;
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByNameThreadSafe(
+			AnimInstance, VarName, bSuccess, DampingProperty, &Value, Params);
+		return bSuccess;
+	};
+
+	// The structure member of the anim instance is got on a worker thread, as the anim graph does.
+	TFuture<float> WorkerValue = Async(EAsyncExecution::ThreadPool,
+		[&Get, DampingName]()
+		{
+			float Value = 0.0f;
+			return Get(DampingName, Value) ? Value : -1.0f;
+		});
+	TestEqual(TEXT("The structure member should be got on the worker thread"), WorkerValue.Get(), 0.5f);
+
+	// The paths which leave the memory of the anim instance are refused.
+	const TCHAR* OutsidePaths[] = {TEXT("LinkedInstance.BoneSettings.Damping"), TEXT("BoneSettingsList[0].Damping")};
+	for (const TCHAR* OutsidePath : OutsidePaths)
+	{
+		float Value = 0.0f;
+		TestFalse(FString::Printf(TEXT("'%s' should be refused"), OutsidePath), Get(FName(OutsidePath), Value));
+	}
+
+	// The read after the invalidation resolves the path again once, and then uses the cached offset.
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+	float Value = 0.0f;
+	Get(DampingName, Value);
+	const int32 NumRepeats = 100;
+	int32 NumSucceeded = 0;
+	FAllocationCounter& Counter = FAllocationCounter::Get();
+	Counter.Install();
+	for (int32 Index = 0; Index < NumRepeats; ++Index)
+	{
+		NumSucceeded += Get(DampingName, Value) ? 1 : 0;
+	}
+	Counter.Uninstall();
+	TestEqual(TEXT("All gets should succeed"), NumSucceeded, NumRepeats);
+	TestEqual(TEXT("Repeated gets should not allocate"), Counter.GetNumAllocations(), 0);
+
+#if WITH_EDITOR
+	// The node refuses the same paths on the compilation.
+	UClass* AnimInstanceClass = UFunctionalTestAnimInstance::StaticClass();
+	TArray<FVarDescription> VarDescs;
+	FVariableAccessFunctionLibraryUtils::ParseVarName(FString(TEXT("BoneSettings.Damping")), &VarDescs);
+	TestTrue(TEXT("The structure member should be within the anim instance"), IsPathWithinTarget(VarDescs, AnimInstanceClass));
+	for (const TCHAR* OutsidePath : OutsidePaths)
+	{
+		FVariableAccessFunctionLibraryUtils::ParseVarName(FString(OutsidePath), &VarDescs);
+		TestFalse(FString::Printf(TEXT("'%s' should not be within the anim instance"), OutsidePath),
+			IsPathWithinTarget(VarDescs, AnimInstanceClass));
+	}
+#endif
+
+	return true;
+}
+
+bool FFunctionalTestSnapshot::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+	Actor->InitialLifeSpan = 3.0f;
+	Actor->PrimaryActorTick.TickInterval = 0.25f;
+
+	FVarAccessSnapshot Snapshot;
+	const FVarAccessSnapshotHandle LifeSpan = Snapshot.AddVariable(Actor, TEXT("InitialLifeSpan"));
+	const FVarAccessSnapshotHandle TickInterval = Snapshot.AddVariable(Actor, TEXT("PrimaryActorTick.TickInterval"));
+	TestTrue(TEXT("The variables should be added"), LifeSpan.IsValid() && TickInterval.IsValid());
+	TestTrue(TEXT("The variables should be captured"), Snapshot.Capture());
+
+	// The captured values are read on a worker thread.
+	TFuture<float> WorkerValue = Async(EAsyncExecution::Thread,
+		[&Snapshot, TickInterval]()
+		{
+			FVarAccessSnapshot::FReadScope ReadScope(Snapshot);
+			return ReadScope.Get<float>(TickInterval).Get(0.0f);
+		});
+	TestEqual(TEXT("The captured value should be read on the worker thread"), WorkerValue.Get(), 0.25f);
+
+	// The value changed after the capture is not seen until the next capture.
+	Actor->PrimaryActorTick.TickInterval = 0.5f;
+	{
+		FVarAccessSnapshot::FReadScope ReadScope(Snapshot);
+		TestEqual(TEXT("The value should be the captured one"), ReadScope.Get<float>(TickInterval).Get(0.0f), 0.25f);
+	}
+
+	// The removed variable is not captured again.
+	Snapshot.RemoveVariable(LifeSpan);
+	TestTrue(TEXT("The variables should be captured again"), Snapshot.Capture());
+	{
+		FVarAccessSnapshot::FReadScope ReadScope(Snapshot);
+		TestFalse(TEXT("The removed variable should not be read"), ReadScope.Get<float>(LifeSpan).IsSet());
+		TestEqual(TEXT("The new value should be read"), ReadScope.Get<float>(TickInterval).Get(0.0f), 0.5f);
+	}
+
+	// The values captured before the invalidation are dropped on the next capture.
+	const FVarAccessSnapshotBuffer* StaleBuffer = nullptr;
+	{
+		FVarAccessSnapshot::FReadScope ReadScope(Snapshot);
+		StaleBuffer = ReadScope.GetBuffer();
+	}
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+	TestTrue(TEXT("The variables should be captured after the invalidation"), Snapshot.Capture());
+	TestTrue(TEXT("The values captured before the invalidation should be dropped"),
+		StaleBuffer != nullptr && StaleBuffer->Find(TickInterval).Get<0>() == nullptr);
+	{
+		FVarAccessSnapshot::FReadScope ReadScope(Snapshot);
+		TestEqual(TEXT("The value should be read after the invalidation"), ReadScope.Get<float>(TickInterval).Get(0.0f), 0.5f);
+	}
+
+	// The garbage collection drops the captured values until the next capture.
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	{
+		FVarAccessSnapshot::FReadScope ReadScope(Snapshot);
+		TestNull(TEXT("No buffer should be published after the garbage collection"), ReadScope.GetBuffer());
+	}
+	TestTrue(TEXT("The variables should be captured after the garbage collection"), Snapshot.Capture());
+	{
+		FVarAccessSnapshot::FReadScope ReadScope(Snapshot);
+		TestEqual(TEXT("The value should be read after the garbage collection"), ReadScope.Get<float>(TickInterval).Get(0.0f),
+			0.5f);
+	}
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestArrayByName::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+	Actor->Tags.Reset();
+
+	FArrayProperty* TagsProperty = FindFProperty<FArrayProperty>(AActor::StaticClass(), TEXT("Tags"));
+	FProperty* LifeSpanProperty = FindFProperty<FProperty>(AActor::StaticClass(), TEXT("InitialLifeSpan"));
+	TestNotNull(TEXT("Tags should be found"), TagsProperty);
+	TestNotNull(TEXT("InitialLifeSpan should be found"), LifeSpanProperty);
+	if (TagsProperty == nullptr || LifeSpanProperty == nullptr)
+	{
+		return false;
+	}
+
+	const FName TagsName(TEXT("Tags"));
+	const FAccessVariableParams Params;
+	bool bSuccess = false;
+
+	// The array of the target is changed in place.
+	FName NewTag(TEXT("First"));
+	TestEqual(TEXT("The item should be added at the end"),
+		UVariableArrayFunctionLibrary::GenericArrayAddByName(Actor, TagsName, bSuccess, TagsProperty->Inner, &NewTag, Params), 0);
+	TestTrue(TEXT("The item should be added"), bSuccess);
+	NewTag = TEXT("Second");
+	UVariableArrayFunctionLibrary::GenericArrayInsertByName(Actor, TagsName, 0, bSuccess, TagsProperty->Inner, &NewTag, Params);
+	TestTrue(TEXT("The item should be inserted"), bSuccess);
+	TestEqual(TEXT("The array of the target should have 2 items"), Actor->Tags.Num(), 2);
+	TestTrue(TEXT("The inserted item should be first"), Actor->Tags[0] == TEXT("Second"));
+	TestEqual(TEXT("Num should be the number of the items"),
+		UVariableArrayFunctionLibrary::ArrayNumByName(Actor, TagsName, Params, bSuccess), 2);
+	UVariableArrayFunctionLibrary::ArrayRemoveAtByName(Actor, TagsName, 0, Params, bSuccess);
+	TestTrue(TEXT("The item should be removed"), bSuccess);
+	TestTrue(TEXT("The remaining item should be first"), Actor->Tags[0] == TEXT("First"));
+
+	// The index out of range is refused without changing the array.
+	UVariableArrayFunctionLibrary::ArrayRemoveAtByName(Actor, TagsName, 1, Params, bSuccess);
+	TestFalse(TEXT("The item out of range should not be removed"), bSuccess);
+	UVariableArrayFunctionLibrary::GenericArrayInsertByName(Actor, TagsName, 2, bSuccess, TagsProperty->Inner, &NewTag, Params);
+	TestFalse(TEXT("The item should not be inserted out of range"), bSuccess);
+	UVariableArrayFunctionLibrary::GenericArrayInsertByName(Actor, TagsName, -1, bSuccess, TagsProperty->Inner, &NewTag, Params);
+	TestFalse(TEXT("The item should not be inserted at the negative index"), bSuccess);
+	TestEqual(TEXT("The refused operations should not change the array"), Actor->Tags.Num(), 1);
+
+	// The item of another type and the variable which is not an array are refused.
+	float NewLifeSpan = 1.0f;
+	UVariableArrayFunctionLibrary::GenericArrayAddByName(Actor, TagsName, bSuccess, LifeSpanProperty, &NewLifeSpan, Params);
+	TestFalse(TEXT("The item of another type should not be added"), bSuccess);
+	UVariableArrayFunctionLibrary::ArrayNumByName(Actor, TEXT("InitialLifeSpan"), Params, bSuccess);
+	TestFalse(TEXT("The variable which is not an array should be refused"), bSuccess);
+	TestEqual(TEXT("The refused operations should not change the array"), Actor->Tags.Num(), 1);
+
+	// The variable is not read into the null destination.
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(Actor, TagsName, bSuccess, nullptr, nullptr, Params);
+	TestFalse(TEXT("The variable should not be read into the null destination"), bSuccess);
+
+	// The resolved path is reused on the repeated operation.
+	const int32 NumRepeats = 100;
+	int32 NumSucceeded = 0;
+	FAllocationCounter& Counter = FAllocationCounter::Get();
+	Counter.Install();
+	for (int32 Index = 0; Index < NumRepeats; ++Index)
+	{
+		UVariableArrayFunctionLibrary::ArrayNumByName(Actor, TagsName, Params, bSuccess);
+		NumSucceeded += bSuccess ? 1 : 0;
+	}
+	Counter.Uninstall();
+	TestEqual(TEXT("All operations should succeed"), NumSucceeded, NumRepeats);
+	TestEqual(TEXT("Repeated operations should not allocate"), Counter.GetNumAllocations(), 0);
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestMapByName::RunTest(const FString& Parameters)
+{
+	UFunctionalTestContainers* Containers = NewObject<UFunctionalTestContainers>();
+	FMapProperty* MapProperty = FindFProperty<FMapProperty>(UFunctionalTestContainers::StaticClass(), TEXT("NameCounts"));
+	FArrayProperty* NamesProperty = FindFProperty<FArrayProperty>(AActor::StaticClass(), TEXT("Tags"));
+	TestNotNull(TEXT("NameCounts should be found"), MapProperty);
+	TestNotNull(TEXT("Tags should be found"), NamesProperty);
+	if (MapProperty == nullptr || NamesProperty == nullptr)
+	{
+		return false;
+	}
+
+	const FName MapName(TEXT("NameCounts"));
+	const FAccessVariableParams Params;
+	bool bSuccess = false;
+
+	// The pairs are added to the map of the target with the name keys.
+	FName Key(TEXT("Apple"));
+	int32 Value = 1;
+	UVariableMapFunctionLibrary::GenericMapAddByName(
+		Containers, MapName, bSuccess, MapProperty->KeyProp, &Key, MapProperty->ValueProp, &Value, Params);
+	TestTrue(TEXT("The pair should be added"), bSuccess);
+	Key = TEXT("Banana");
+	Value = 2;
+	UVariableMapFunctionLibrary::GenericMapAddByName(
+		Containers, MapName, bSuccess, MapProperty->KeyProp, &Key, MapProperty->ValueProp, &Value, Params);
+	TestEqual(TEXT("The map of the target should have 2 pairs"), Containers->NameCounts.Num(), 2);
+	TestEqual(TEXT("The value should be added with the key"), Containers->NameCounts.FindRef(TEXT("Banana")), 2);
+	TestEqual(TEXT("Num should be the number of the pairs"),
+		UVariableMapFunctionLibrary::MapNumByName(Containers, MapName, Params, bSuccess), 2);
+
+	Key = TEXT("Apple");
+	TestTrue(TEXT("The existing key should be contained"),
+		UVariableMapFunctionLibrary::GenericMapContainsByName(Containers, MapName, bSuccess, MapProperty->KeyProp, &Key, Params));
+	TestTrue(TEXT("The removal should succeed"),
+		UVariableMapFunctionLibrary::GenericMapRemoveByName(Containers, MapName, bSuccess, MapProperty->KeyProp, &Key, Params));
+
+	TArray<FName> Keys;
+	UVariableMapFunctionLibrary::GenericMapKeysByName(Containers, MapName, bSuccess, NamesProperty, &Keys, Params);
+	TestTrue(TEXT("The keys should be got"), bSuccess);
+	TestTrue(TEXT("Only the remaining key should be got"), Keys.Num() == 1 && Keys[0] == TEXT("Banana"));
+
+	// The missing key is not found, but the operation succeeds.
+	Key = TEXT("Cherry");
+	TestFalse(TEXT("The missing key should not be contained"),
+		UVariableMapFunctionLibrary::GenericMapContainsByName(Containers, MapName, bSuccess, MapProperty->KeyProp, &Key, Params));
+	TestTrue(TEXT("The lookup of the missing key should succeed"), bSuccess);
+	TestFalse(TEXT("The missing key should not be removed"),
+		UVariableMapFunctionLibrary::GenericMapRemoveByName(Containers, MapName, bSuccess, MapProperty->KeyProp, &Key, Params));
+	TestTrue(TEXT("The removal of the missing key should succeed"), bSuccess);
+
+	// The key of another type is refused.
+	int32 WrongKey = 0;
+	UVariableMapFunctionLibrary::GenericMapContainsByName(
+		Containers, MapName, bSuccess, MapProperty->ValueProp, &WrongKey, Params);
+	TestFalse(TEXT("The key of another type should be refused"), bSuccess);
+	TestEqual(TEXT("The refused operations should not change the map"), Containers->NameCounts.Num(), 1);
+
+	// The resolved path is reused on the repeated operation.
+	const int32 NumRepeats = 100;
+	int32 NumSucceeded = 0;
+	FAllocationCounter& Counter = FAllocationCounter::Get();
+	Counter.Install();
+	for (int32 Index = 0; Index < NumRepeats; ++Index)
+	{
+		UVariableMapFunctionLibrary::MapNumByName(Containers, MapName, Params, bSuccess);
+		NumSucceeded += bSuccess ? 1 : 0;
+	}
+	Counter.Uninstall();
+	TestEqual(TEXT("All operations should succeed"), NumSucceeded, NumRepeats);
+	TestEqual(TEXT("Repeated operations should not allocate"), Counter.GetNumAllocations(), 0);
+
+	return true;
+}
+
+#if WITH_EDITOR
+// Add a function which passes each element of the container to AddToSum through 'For Each Element by Name' node.
+void AddForEachSumFunction(UBlueprint* Blueprint, FName FunctionName, const TCHAR* VarName, FName ElementName)
+{
+	UEdGraph* Graph =
+		FBlueprintEditorUtils::CreateNewGraph(Blueprint, FunctionName, UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+	FBlueprintEditorUtils::AddFunctionGraph<UClass>(Blueprint, Graph, true, nullptr);
+	TArray<UK2Node_FunctionEntry*> EntryNodes;
+	Graph->GetNodesOfClass(EntryNodes);
+
+	UK2Node_ForEachElementByNameNode* ForEach = NewObject<UK2Node_ForEachElementByNameNode>(Graph);
+	Graph->AddNode(ForEach, false, false);
+	ForEach->CreateNewGuid();
+	ForEach->AllocateDefaultPins();
+	UEdGraphPin* VarNamePin = ForEach->FindPinChecked(TEXT("VarName"));
+	VarNamePin->DefaultValue = VarName;
+	ForEach->PinDefaultValueChanged(VarNamePin);
+
+	UK2Node_CallFunction* AddToSum = NewObject<UK2Node_CallFunction>(Graph);
+	Graph->AddNode(AddToSum, false, false);
+	AddToSum->CreateNewGuid();
+	AddToSum->SetFromFunction(UFunctionalTestContainers::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UFunctionalTestContainers, AddToSum)));
+	AddToSum->AllocateDefaultPins();
+
+	EntryNodes[0]->FindPinChecked(UEdGraphSchema_K2::PN_Then)->MakeLinkTo(ForEach->GetExecPin());
+	ForEach->FindPinChecked(TEXT("LoopBody"))->MakeLinkTo(AddToSum->GetExecPin());
+	ForEach->FindPinChecked(ElementName)->MakeLinkTo(AddToSum->FindPinChecked(TEXT("Value")));
+}
+#endif
+
+bool FFunctionalTestForEachElementByName::RunTest(const FString& Parameters)
+{
+#if WITH_EDITOR
+	UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(UFunctionalTestContainers::StaticClass(),
+		GetTransientPackage(), TEXT("ForEachElementByNameTest"), BPTYPE_Normal, UBlueprint::StaticClass(),
+		UBlueprintGeneratedClass::StaticClass());
+	const FName ArrayFunctionName(TEXT("Test_ForEachArray"));
+	const FName MapFunctionName(TEXT("Test_ForEachMap"));
+	AddForEachSumFunction(Blueprint, ArrayFunctionName, TEXT("Values"), TEXT("Element"));
+	AddForEachSumFunction(Blueprint, MapFunctionName, TEXT("NameCounts"), TEXT("Value"));
+	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	TestTrue(TEXT("The Blueprint should be compiled"), Blueprint->Status != BS_Error);
+
+	UFunction* ArrayFunction = Blueprint->GeneratedClass->FindFunctionByName(ArrayFunctionName);
+	UFunction* MapFunction = Blueprint->GeneratedClass->FindFunctionByName(MapFunctionName);
+	TestNotNull(TEXT("The array loop should be compiled"), ArrayFunction);
+	TestNotNull(TEXT("The map loop should be compiled"), MapFunction);
+	if (ArrayFunction == nullptr || MapFunction == nullptr)
+	{
+		return false;
+	}
+
+	// The loop resolves the container by the view function only, and indexes it in the loop.
+	UClass* ArrayLibrary = UVariableArrayFunctionLibrary::StaticClass();
+	UClass* MapLibrary = UVariableMapFunctionLibrary::StaticClass();
+	TestEqual(TEXT("The array should be resolved by the view"),
+		CountFunctionCalls(ArrayFunction,
+			ArrayLibrary->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UVariableArrayFunctionLibrary, ArrayViewByName))),
+		1);
+	TestEqual(TEXT("The array should not be resolved per item"),
+		CountFunctionCalls(ArrayFunction,
+			ArrayLibrary->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UVariableArrayFunctionLibrary, ArrayNumByName))),
+		0);
+	TestEqual(TEXT("The map should be resolved by the view"),
+		CountFunctionCalls(MapFunction,
+			MapLibrary->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UVariableMapFunctionLibrary, MapViewByName))),
+		1);
+
+	UFunctionalTestContainers* Containers =
+		NewObject<UFunctionalTestContainers>(GetTransientPackage(), Blueprint->GeneratedClass);
+	Containers->Values = {1, 2, 3};
+	Containers->ProcessEvent(ArrayFunction, nullptr);
+	TestEqual(TEXT("All items of the array should be visited"), Containers->Sum, 6);
+
+	// The removed pair leaves a hole in the map, which is skipped.
+	Containers->NameCounts.Add(TEXT("Apple"), 10);
+	Containers->NameCounts.Add(TEXT("Banana"), 20);
+	Containers->NameCounts.Add(TEXT("Cherry"), 30);
+	Containers->NameCounts.Remove(TEXT("Banana"));
+	Containers->Sum = 0;
+	Containers->ProcessEvent(MapFunction, nullptr);
+	TestEqual(TEXT("All pairs of the sparse map should be visited"), Containers->Sum, 40);
+#endif
+
+	return true;
+}
+
+bool FFunctionalTestAccessJobs::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	UVariableAccessJobSubsystem* Subsystem = World->GetSubsystem<UVariableAccessJobSubsystem>();
+	AActor* Actor = World->SpawnActor<AActor>();
+	APawn* Pawn = World->SpawnActor<APawn>();
+	AActor* OtherActor = World->SpawnActor<AActor>();
+	TestNotNull(TEXT("Subsystem should not be null"), Subsystem);
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	TestNotNull(TEXT("Pawn should not be null"), Pawn);
+	TestNotNull(TEXT("Other actor should not be null"), OtherActor);
+	if (Subsystem == nullptr || Actor == nullptr || Pawn == nullptr || OtherActor == nullptr)
+	{
+		return false;
+	}
+	Actor->InitialLifeSpan = 1.0f;
+	Pawn->InitialLifeSpan = 2.0f;
+	OtherActor->InitialLifeSpan = 3.0f;
+
+	FProperty* LifeSpanProperty = FindFProperty<FProperty>(AActor::StaticClass(), TEXT("InitialLifeSpan"));
+	FProperty* SumProperty = FindFProperty<FProperty>(UFunctionalTestContainers::StaticClass(), TEXT("Sum"));
+	TestNotNull(TEXT("InitialLifeSpan should be found"), LifeSpanProperty);
+	TestNotNull(TEXT("Sum should be found"), SumProperty);
+	if (LifeSpanProperty == nullptr || SumProperty == nullptr)
+	{
+		return false;
+	}
+
+	// The targets of different classes are interleaved, so that the chains are looked up per run of the same class.
+	TArray<TWeakObjectPtr<UObject>> Targets = {Actor, Pawn, nullptr, OtherActor};
+	float Values[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	bool Succeeded[4] = {false, false, false, false};
+	FVarAccessJob GetJob;
+	GetJob.Targets = Targets;
+	GetJob.VarName = TEXT("InitialLifeSpan");
+	GetJob.ValueProperty = LifeSpanProperty;
+	GetJob.Buffer = Values;
+	GetJob.Succeeded = Succeeded;
+	FVarAccessJobHandle GetHandle = Subsystem->RegisterJob(GetJob);
+	TestTrue(TEXT("The Get job should be registered"), GetHandle.IsValid());
+
+	Subsystem->ExecuteJobs(TG_PrePhysics);
+	TestTrue(TEXT("The values of the targets should be read"), Succeeded[0] && Succeeded[1] && Succeeded[3]);
+	TestFalse(TEXT("The value of the null target should not be read"), Succeeded[2]);
+	TestEqual(TEXT("The value of the actor should be read"), Values[0], 1.0f);
+	TestEqual(TEXT("The value of the pawn should be read"), Values[1], 2.0f);
+	TestEqual(TEXT("The value of the other actor should be read"), Values[3], 3.0f);
+
+	// The job of another tick group is not executed.
+	Actor->InitialLifeSpan = 4.0f;
+	Subsystem->ExecuteJobs(TG_PostPhysics);
+	TestEqual(TEXT("The job of another tick group should not be executed"), Values[0], 1.0f);
+	Subsystem->UnregisterJob(GetHandle);
+	Subsystem->ExecuteJobs(TG_PrePhysics);
+	TestEqual(TEXT("The unregistered job should not be executed"), Values[0], 1.0f);
+
+	// The values are written from the buffer on Set.
+	float NewValues[4] = {5.0f, 6.0f, 0.0f, 7.0f};
+	FVarAccessJob SetJob = GetJob;
+	SetJob.Mode = EVarAccessJobMode::Set;
+	SetJob.Buffer = NewValues;
+	SetJob.TickGroup = TG_PostPhysics;
+	FVarAccessJobHandle SetHandle = Subsystem->RegisterJob(SetJob);
+	TestTrue(TEXT("The Set job should be registered"), SetHandle.IsValid());
+	Subsystem->ExecuteJobs(TG_PostPhysics);
+	TestTrue(TEXT("The values of the targets should be written"), Succeeded[0] && Succeeded[1] && Succeeded[3]);
+	TestEqual(TEXT("The value of the actor should be written"), Actor->InitialLifeSpan, 5.0f);
+	TestEqual(TEXT("The value of the pawn should be written"), Pawn->InitialLifeSpan, 6.0f);
+	TestEqual(TEXT("The value of the other actor should be written"), OtherActor->InitialLifeSpan, 7.0f);
+	Subsystem->UnregisterJob(SetHandle);
+
+	FVarAccessJob InvalidJob = SetJob;
+	InvalidJob.Buffer = nullptr;
+	TestFalse(TEXT("The Set job without the buffer should be refused"), Subsystem->RegisterJob(InvalidJob).IsValid());
+
+	// Enough values are copied on the worker threads.
+	const int32 NumObjects = 1000;
+	TArray<TWeakObjectPtr<UObject>> Objects;
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+	{
+		UFunctionalTestContainers* Object = NewObject<UFunctionalTestContainers>();
+		Object->Sum = Index;
+		Objects.Add(Object);
+	}
+	TArray<int32> Sums;
+	Sums.Init(-1, NumObjects);
+	FVarAccessJob ParallelJob;
+	ParallelJob.Targets = Objects;
+	ParallelJob.VarName = TEXT("Sum");
+	ParallelJob.ValueProperty = SumProperty;
+	ParallelJob.Buffer = Sums.GetData();
+	ParallelJob.bParallel = true;
+	FVarAccessJobHandle ParallelHandle = Subsystem->RegisterJob(ParallelJob);
+	Subsystem->ExecuteJobs(TG_PrePhysics);
+	Subsystem->UnregisterJob(ParallelHandle);
+	int32 NumCopied = 0;
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+	{
+		NumCopied += Sums[Index] == Index ? 1 : 0;
+	}
+	TestEqual(TEXT("All values should be copied on the worker threads"), NumCopied, NumObjects);
+
+	// The callbacks change the jobs while they are executed. The changes apply after the jobs of the group.
+	// The job which is executed first unregisters both jobs and registers another job on its first callback.
+	FVarAccessJobHandle Handles[2];
+	FVarAccessJobHandle AddedHandle;
+	int32 NumCallbacks[2] = {0, 0};
+	int32 NumAddedCallbacks = 0;
+	FVarAccessJob AddedJob = GetJob;
+	AddedJob.Buffer = nullptr;
+	AddedJob.Succeeded = nullptr;
+	AddedJob.Callback = [&NumAddedCallbacks](int32, UObject*, const FProperty*, const void*) { ++NumAddedCallbacks; };
+	for (int32 JobIndex = 0; JobIndex < 2; ++JobIndex)
+	{
+		FVarAccessJob CallbackJob = AddedJob;
+		CallbackJob.Callback = [&, JobIndex](int32, UObject*, const FProperty*, const void*)
+		{
+			if (++NumCallbacks[JobIndex] == 1)
+			{
+				Subsystem->UnregisterJob(Handles[0]);
+				Subsystem->UnregisterJob(Handles[1]);
+				AddedHandle = Subsystem->RegisterJob(AddedJob);
+				Subsystem->SetJobTargets(AddedHandle, {Actor}, nullptr, nullptr);
+			}
+		};
+		Handles[JobIndex] = Subsystem->RegisterJob(CallbackJob);
+	}
+	Subsystem->ExecuteJobs(TG_PrePhysics);
+	TestEqual(TEXT("Only the job executed first should call back, for all of its targets"), NumCallbacks[0] + NumCallbacks[1],
+		3);
+	TestTrue(TEXT("The job unregistered by the callback should not be executed"), NumCallbacks[0] == 0 || NumCallbacks[1] == 0);
+	TestEqual(TEXT("The job registered by the callback should not be executed in the same execution"), NumAddedCallbacks, 0);
+
+	Subsystem->ExecuteJobs(TG_PrePhysics);
+	TestEqual(TEXT("The unregistered jobs should not be executed any more"), NumCallbacks[0] + NumCallbacks[1], 3);
+	TestEqual(TEXT("The job registered by the callback should be executed with its new targets"), NumAddedCallbacks, 1);
+	Subsystem->UnregisterJob(AddedHandle);
+
+	Actor->Destroy();
+	Pawn->Destroy();
+	OtherActor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestBulkAccess::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	FProperty* SumProperty = FindFProperty<FProperty>(UFunctionalTestContainers::StaticClass(), TEXT("Sum"));
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	TestNotNull(TEXT("Sum should be found"), SumProperty);
+	if (Actor == nullptr || SumProperty == nullptr)
+	{
+		return false;
+	}
+
+	const int32 NumObjects = 100;
+	TArray<UObject*> Objects;
+	TArray<TWeakObjectPtr<UObject>> WeakObjects;
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+	{
+		UFunctionalTestContainers* Object = NewObject<UFunctionalTestContainers>();
+		Object->Sum = Index;
+		Objects.Add(Object);
+		WeakObjects.Add(Object);
+	}
+
+	// The step without the budget processes only a part of the targets, and the next step continues from there.
+	FVarAccessBulkOperation GetOperation(
+		EVarAccessJobMode::Get, WeakObjects, TEXT("Sum"), SumProperty, nullptr, FAccessVariableParams());
+	TestFalse(TEXT("The step without the budget should not finish the operation"), GetOperation.Step(0.0));
+	const float FirstProgress = GetOperation.GetProgress();
+	TestTrue(TEXT("The first step should process a part of the targets"), FirstProgress > 0.0f && FirstProgress < 1.0f);
+	TestFalse(TEXT("The second step should not finish the operation"), GetOperation.Step(0.0));
+	TestTrue(TEXT("The second step should make progress"), GetOperation.GetProgress() > FirstProgress);
+	TestTrue(TEXT("The step with enough budget should finish the operation"), GetOperation.Step(10.0));
+	TestEqual(TEXT("The operation should be complete"), GetOperation.GetProgress(), 1.0f);
+	TestEqual(TEXT("All targets should be read"), GetOperation.GetNumSucceeded(), NumObjects);
+	int32 Value = -1;
+	TestTrue(TEXT("The value of the last target should be read"), GetOperation.GetValue(NumObjects - 1, &Value));
+	TestEqual(TEXT("The value of the last target should be its variable"), Value, NumObjects - 1);
+
+	// The cancelled operation does not process the remaining targets.
+	int32 NewValue = 7;
+	FVarAccessBulkOperation SetOperation(
+		EVarAccessJobMode::Set, WeakObjects, TEXT("Sum"), SumProperty, &NewValue, FAccessVariableParams());
+	SetOperation.Step(0.0);
+	const int32 NumSet = SetOperation.GetNumSucceeded();
+	TestTrue(TEXT("The first step should write a part of the targets"), NumSet > 0 && NumSet < NumObjects);
+	SetOperation.Cancel();
+	TestTrue(TEXT("The cancelled operation should be finished"), SetOperation.IsFinished() && SetOperation.IsCancelled());
+	TestTrue(TEXT("The step of the cancelled operation should finish at once"), SetOperation.Step(10.0));
+	TestEqual(TEXT("The cancelled operation should not write any more"), SetOperation.GetNumSucceeded(), NumSet);
+	TestEqual(TEXT("The last target should not be written"), CastChecked<UFunctionalTestContainers>(Objects.Last())->Sum,
+		NumObjects - 1);
+
+	// The named operation is found while it runs, and is forgotten when it is cancelled or finished.
+	// The actions of the object are processed once per frame, so that a frame is begun before each processing.
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	const FName OperationName(TEXT("FunctionalTestBulkAccess"));
+	FLatentActionInfo LatentInfo;
+	LatentInfo.CallbackTarget = Actor;
+	LatentInfo.UUID = 1;
+	LatentInfo.Linkage = INDEX_NONE;
+	int32 NumSucceeded = 0;
+	UVariableBulkAccessFunctionLibrary::GenericBulkSetNestedVariableByName(Actor, Objects, TEXT("Sum"), FAccessVariableParams(),
+		0.0f, OperationName, LatentInfo, &NumSucceeded, SumProperty, &NewValue);
+	TestEqual(TEXT("The named operation should be found before it runs"),
+		UVariableBulkAccessFunctionLibrary::GetBulkOperationProgress(OperationName), 0.0f);
+	LatentActionManager.BeginFrame();
+	LatentActionManager.ProcessLatentActions(Actor, 0.0f);
+	const float NamedProgress = UVariableBulkAccessFunctionLibrary::GetBulkOperationProgress(OperationName);
+	TestTrue(TEXT("The named operation should make progress"), NamedProgress > 0.0f && NamedProgress < 1.0f);
+	UVariableBulkAccessFunctionLibrary::CancelBulkOperation(OperationName);
+	TestEqual(TEXT("The cancelled operation should be forgotten"),
+		UVariableBulkAccessFunctionLibrary::GetBulkOperationProgress(OperationName), -1.0f);
+	LatentActionManager.BeginFrame();
+	LatentActionManager.ProcessLatentActions(Actor, 0.0f);
+	TestTrue(TEXT("The cancelled operation should not write all targets"), NumSucceeded < NumObjects);
+
+	LatentInfo.UUID = 2;
+	UVariableBulkAccessFunctionLibrary::GenericBulkSetNestedVariableByName(Actor, Objects, TEXT("Sum"), FAccessVariableParams(),
+		10000.0f, OperationName, LatentInfo, &NumSucceeded, SumProperty, &NewValue);
+	LatentActionManager.BeginFrame();
+	LatentActionManager.ProcessLatentActions(Actor, 0.0f);
+	TestEqual(TEXT("The operation with enough budget should write all targets in a frame"), NumSucceeded, NumObjects);
+	TestEqual(TEXT("The finished operation should be forgotten"),
+		UVariableBulkAccessFunctionLibrary::GetBulkOperationProgress(OperationName), -1.0f);
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestCallSiteCache::RunTest(const FString& Parameters)
+{
+#ifndef AVBN_FREE_VERSION
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	APawn* Pawn = World->SpawnActor<APawn>();
+	UFunctionalTestContainers* Containers = NewObject<UFunctionalTestContainers>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	TestNotNull(TEXT("Pawn should not be null"), Pawn);
+	if (Actor == nullptr || Pawn == nullptr)
+	{
+		return false;
+	}
+	Actor->InitialLifeSpan = 1.0f;
+	Pawn->InitialLifeSpan = 2.0f;
+
+	// Any place in the bytecode identifies a call site.
+	FVarAccessCallSiteKey CallSite;
+	CallSite.Function = UFunctionalTestContainers::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UFunctionalTestContainers, AddToSum));
+	CallSite.CodeOffset = 0;
+	const FName LifeSpanName(TEXT("InitialLifeSpan"));
+	const FName DilationName(TEXT("CustomTimeDilation"));
+	const FAccessVariableParams Params;
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+
+	// The call site remembers the chain per class of the target.
+	FVarAccessChain* ActorChain = FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Actor, LifeSpanName, Params);
+	TestNotNull(TEXT("The chain should be cached on the call site"), ActorChain);
+	if (ActorChain == nullptr)
+	{
+		return false;
+	}
+	TestTrue(TEXT("The same class should find the same chain"),
+		FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Actor, LifeSpanName, Params) == ActorChain);
+	TTuple<FProperty*, void*> Terminal =
+		FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(ActorChain, Actor, nullptr, Params);
+	TestTrue(TEXT("The cached chain should resolve the variable of the target"),
+		Terminal.Get<1>() == &Actor->InitialLifeSpan);
+	FVarAccessChain* PawnChain = FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Pawn, LifeSpanName, Params);
+	TestTrue(TEXT("Another class should have its own chain"), PawnChain != nullptr && PawnChain != ActorChain);
+	if (PawnChain != nullptr)
+	{
+		Terminal = FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(PawnChain, Pawn, nullptr, Params);
+		TestTrue(TEXT("The chain of another class should resolve its variable"), Terminal.Get<1>() == &Pawn->InitialLifeSpan);
+	}
+
+	// The call site which sees too many classes or paths stops caching.
+	TestNotNull(TEXT("The third entry should be cached"),
+		FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Actor, DilationName, Params));
+	TestNotNull(TEXT("The fourth entry should be cached"),
+		FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Containers, FName(TEXT("Sum")), Params));
+	TestNull(TEXT("The fifth entry should make the call site megamorphic"),
+		FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Pawn, DilationName, Params));
+	TestNull(TEXT("The megamorphic call site should not find the cached entries any more"),
+		FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Actor, LifeSpanName, Params));
+
+	// The invalidation of the caches forgets the call site.
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+	TestNotNull(TEXT("The call site should cache again after the invalidation"),
+		FVariableAccessFunctionLibraryUtils::FindCallSiteChain(CallSite, Actor, LifeSpanName, Params));
+
+	// The call site without the bytecode is not cached.
+	TestNull(TEXT("The invalid call site should not be cached"),
+		FVariableAccessFunctionLibraryUtils::FindCallSiteChain(FVarAccessCallSiteKey(), Actor, LifeSpanName, Params));
+
+	Actor->Destroy();
+	Pawn->Destroy();
+#endif
+
+	return true;
+}
+
+bool FFunctionalTestPathArguments::RunTest(const FString& Parameters)
+{
+#ifndef AVBN_FREE_VERSION
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	UFunctionalTestContainers* Containers = NewObject<UFunctionalTestContainers>();
+	FArrayProperty* TagsProperty = FindFProperty<FArrayProperty>(AActor::StaticClass(), TEXT("Tags"));
+	FProperty* SumProperty = FindFProperty<FProperty>(UFunctionalTestContainers::StaticClass(), TEXT("Sum"));
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	TestNotNull(TEXT("Tags should be found"), TagsProperty);
+	TestNotNull(TEXT("Sum should be found"), SumProperty);
+	if (Actor == nullptr || TagsProperty == nullptr || SumProperty == nullptr)
+	{
+		return false;
+	}
+	Actor->Tags = {TEXT("First"), TEXT("Second"), TEXT("Third")};
+	Containers->NameCounts.Add(TEXT("Apple"), 3);
+	Containers->NameCounts.Add(TEXT("{0}"), 9);
+
+	const FName TagPath(TEXT("Tags[{0}]"));
+	const FName CountPath(TEXT("NameCounts[\"{0}\"]"));
+	const FAccessVariableParams Params;
+	TArray<int32> IntArguments = {2};
+	TArray<FName> NameArguments = {TEXT("Apple")};
+	FVarAccessArguments Arguments;
+	Arguments.Integers = IntArguments;
+	Arguments.Names = NameArguments;
+	bool bSuccess = false;
+	FName Tag;
+	int32 Count = 0;
+
+	// The placeholders take the index from the integer arguments, and the key from the name arguments.
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+		FVarAccessCallSiteKey(), Actor, TagPath, &Arguments, bSuccess, TagsProperty->Inner, &Tag, Params);
+	TestTrue(TEXT("The item at the index of the argument should be got"), bSuccess && Tag == TEXT("Third"));
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+		FVarAccessCallSiteKey(), Containers, CountPath, &Arguments, bSuccess, SumProperty, &Count, Params);
+	TestTrue(TEXT("The value of the key of the argument should be got"), bSuccess && Count == 3);
+
+	// The substituted path is set as well.
+	IntArguments[0] = 1;
+	FName NewTag(TEXT("Changed"));
+	UVariableSetterFunctionLibarary::GenericSetNestedVariableByName(FVarAccessCallSiteKey(), Actor, TagPath, &Arguments,
+		bSuccess, TagsProperty->Inner, &Tag, TagsProperty->Inner, &NewTag, Params);
+	TestTrue(TEXT("The item at the index of the argument should be set"), bSuccess && Actor->Tags[1] == NewTag);
+
+	// The argument which is not supplied, and the index which is out of the array, fail.
+	TArray<int32> NoIntArguments;
+	FVarAccessArguments MissingArguments;
+	MissingArguments.Integers = NoIntArguments;
+	Tag = TEXT("Stale");
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+		FVarAccessCallSiteKey(), Actor, TagPath, &MissingArguments, bSuccess, TagsProperty->Inner, &Tag, Params);
+	TestFalse(TEXT("The argument which is not supplied should fail"), bSuccess);
+	TestTrue(TEXT("The result of the failed access should be cleared"), Tag.IsNone());
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(FVarAccessCallSiteKey(), Actor,
+		FName(TEXT("Tags[{1}]")), &Arguments, bSuccess, TagsProperty->Inner, &Tag, Params);
+	TestFalse(TEXT("The argument index out of the arguments should fail"), bSuccess);
+	IntArguments[0] = 5;
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+		FVarAccessCallSiteKey(), Actor, TagPath, &Arguments, bSuccess, TagsProperty->Inner, &Tag, Params);
+	TestFalse(TEXT("The index of the argument out of the array should fail"), bSuccess);
+
+	// The call site parses the path once, and substitutes the arguments on each access.
+	FVarAccessCallSiteKey CallSite;
+	CallSite.Function = UFunctionalTestContainers::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UFunctionalTestContainers, AddToSum));
+	CallSite.CodeOffset = 0;
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+	for (int32 Index = 0; Index < Actor->Tags.Num(); ++Index)
+	{
+		IntArguments[0] = Index;
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(
+			CallSite, Actor, TagPath, &Arguments, bSuccess, TagsProperty->Inner, &Tag, Params);
+		TestTrue(FString::Printf(TEXT("The call site should get the item %d"), Index), bSuccess && Tag == Actor->Tags[Index]);
+	}
+
+	// The entry points without the arguments do not substitute the placeholders.
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByName(Containers, CountPath, bSuccess, SumProperty, &Count, Params);
+	TestTrue(TEXT("The key should be the placeholder itself without the arguments"), bSuccess && Count == 9);
+
+	Actor->Destroy();
+#endif
+
+	return true;
+}
+
+bool FFunctionalTestVariableByString::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	FProperty* LifeSpanProperty = FindFProperty<FProperty>(AActor::StaticClass(), TEXT("InitialLifeSpan"));
+	FArrayProperty* TagsProperty = FindFProperty<FArrayProperty>(AActor::StaticClass(), TEXT("Tags"));
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	TestNotNull(TEXT("InitialLifeSpan should be found"), LifeSpanProperty);
+	TestNotNull(TEXT("Tags should be found"), TagsProperty);
+	if (Actor == nullptr || LifeSpanProperty == nullptr || TagsProperty == nullptr)
+	{
+		return false;
+	}
+	Actor->InitialLifeSpan = 1.0f;
+
+	const FAccessVariableParams Params;
+	bool bSuccess = false;
+	float LifeSpan = 0.0f;
+
+	// The variable is got and set by the string name.
+	const FString LifeSpanPath(TEXT("InitialLifeSpan"));
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(
+		Actor, LifeSpanPath, bSuccess, LifeSpanProperty, &LifeSpan, Params);
+	TestTrue(TEXT("The variable should be got by the string name"), bSuccess && LifeSpan == 1.0f);
+	float NewLifeSpan = 2.0f;
+	UVariableSetterFunctionLibarary::GenericSetNestedVariableByString(
+		Actor, LifeSpanPath, bSuccess, LifeSpanProperty, &LifeSpan, LifeSpanProperty, &NewLifeSpan, Params);
+	TestTrue(TEXT("The variable should be set by the string name"), bSuccess && Actor->InitialLifeSpan == 2.0f);
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(
+		Actor, TEXT("NoSuchVariable"), bSuccess, LifeSpanProperty, &LifeSpan, Params);
+	TestFalse(TEXT("The missing variable should fail"), bSuccess);
+
+#ifndef AVBN_FREE_VERSION
+	Actor->Tags = {TEXT("First"), TEXT("Second"), TEXT("Third")};
+	FName Tag;
+
+	// The generated paths are found without adding them to the name table.
+	for (int32 Index = 0; Index < Actor->Tags.Num(); ++Index)
+	{
+		const FString TagPath = FString::Printf(TEXT("Tags[%d]"), Index);
+		UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(
+			Actor, TagPath, bSuccess, TagsProperty->Inner, &Tag, Params);
+		TestTrue(FString::Printf(TEXT("'%s' should be got"), *TagPath), bSuccess && Tag == Actor->Tags[Index]);
+	}
+	const FString OutOfRangePath(TEXT("Tags[424242]"));
+	UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(
+		Actor, OutOfRangePath, bSuccess, TagsProperty->Inner, &Tag, Params);
+	TestFalse(TEXT("The index out of the array should fail"), bSuccess);
+	TestTrue(TEXT("The generated path should not be added to the name table"),
+		FName(*OutOfRangePath, FNAME_Find).IsNone());
+
+	// The call site compares the string names by their content.
+	FVarAccessCallSiteKey CallSite;
+	CallSite.Function = UFunctionalTestContainers::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UFunctionalTestContainers, AddToSum));
+	CallSite.CodeOffset = 0;
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+	for (int32 Repeat = 0; Repeat < 2; ++Repeat)
+	{
+		for (int32 Index = 0; Index < 2; ++Index)
+		{
+			const FString TagPath = FString::Printf(TEXT("Tags[%d]"), Index);
+			UVariableGetterFunctionLibarary::GenericGetNestedVariableByString(
+				CallSite, Actor, TagPath, bSuccess, TagsProperty->Inner, &Tag, Params);
+			TestTrue(FString::Printf(TEXT("The call site should get '%s'"), *TagPath), bSuccess && Tag == Actor->Tags[Index]);
+		}
+	}
+	FName NewTag(TEXT("Changed"));
+	UVariableSetterFunctionLibarary::GenericSetNestedVariableByString(
+		CallSite, Actor, TEXT("Tags[2]"), bSuccess, TagsProperty->Inner, &Tag, TagsProperty->Inner, &NewTag, Params);
+	TestTrue(TEXT("The call site should set the item by the string name"), bSuccess && Actor->Tags[2] == NewTag);
+#endif
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestObjectChain::RunTest(const FString& Parameters)
+{
+	UFunctionalTestAnimInstance* Root = NewObject<UFunctionalTestAnimInstance>();
+	UFunctionalTestAnimInstance* Middle = NewObject<UFunctionalTestAnimInstance>();
+	UFunctionalTestAnimInstance* Leaf = NewObject<UFunctionalTestAnimInstance>();
+	UFunctionalTestAnimInstance* OtherLeaf = NewObject<UFunctionalTestAnimInstance>();
+	UFunctionalTestAnimInstance* OtherRoot = NewObject<UFunctionalTestAnimInstance>();
+	Root->LinkedInstance = Middle;
+	OtherRoot->LinkedInstance = Middle;
+	Middle->LinkedInstance = Leaf;
+
+	FAccessVariableParams Params;
+	Params.bCacheObjectChain = true;
+	FVarAccessChain Chain;
+	FVariableAccessFunctionLibraryUtils::ParseVarName(
+		FString(TEXT("LinkedInstance.LinkedInstance.BoneSettings.Damping")), &Chain.VarDescs);
+	Chain.Links.SetNum(Chain.VarDescs.Num());
+	auto Resolve = [&Chain, &Params](UObject* Target)
+	{
+		return FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(&Chain, Target, nullptr, Params).Get<1>();
+	};
+
+	// The intermediate objects are remembered on the first access, and reused while the references stay.
+	TestTrue(TEXT("The variable of the leaf should be resolved"), Resolve(Root) == &Leaf->BoneSettings.Damping);
+	TestEqual(TEXT("The intermediate objects of the target should be remembered"), Chain.ObjectChains.Num(), 1);
+	if (Chain.ObjectChains.Num() != 1)
+	{
+		return false;
+	}
+	TestEqual(TEXT("Both object references should be remembered"), Chain.ObjectChains[0].Hops.Num(), 2);
+	TestTrue(TEXT("The remembered chain should resolve the same variable"), Resolve(Root) == &Leaf->BoneSettings.Damping);
+
+	// The change of an intermediate reference walks the path again.
+	Middle->LinkedInstance = OtherLeaf;
+	TestTrue(TEXT("The changed intermediate reference should be followed"), Resolve(Root) == &OtherLeaf->BoneSettings.Damping);
+	TestTrue(TEXT("The remembered objects should be rebuilt"),
+		Chain.ObjectChains[0].Hops.Num() == 2 && Chain.ObjectChains[0].Hops[1].Object.Get() == OtherLeaf);
+	Root->LinkedInstance = nullptr;
+	TestNull(TEXT("The cleared reference should fail"), Resolve(Root));
+	Root->LinkedInstance = Middle;
+	TestTrue(TEXT("The restored reference should be followed"), Resolve(Root) == &OtherLeaf->BoneSettings.Damping);
+
+	// Each target remembers its own objects.
+	TestTrue(TEXT("Another target should resolve through its references"),
+		Resolve(OtherRoot) == &OtherLeaf->BoneSettings.Damping);
+	TestEqual(TEXT("Another target should have its own remembered objects"), Chain.ObjectChains.Num(), 2);
+
+	// The objects are not remembered without the option.
+	Params.bCacheObjectChain = false;
+	FVarAccessChain UncachedChain;
+	UncachedChain.VarDescs = Chain.VarDescs;
+	UncachedChain.Links.SetNum(UncachedChain.VarDescs.Num());
+	FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(&UncachedChain, Root, nullptr, Params);
+	TestEqual(TEXT("The objects should not be remembered without the option"), UncachedChain.ObjectChains.Num(), 0);
+
+	return true;
+}
+
+bool FFunctionalTestAsyncAccess::RunTest(const FString& Parameters)
+{
+#if !UE_VERSION_OLDER_THAN(5, 0, 0)
+	UFunctionalTestAnimInstance* AnimInstance = NewObject<UFunctionalTestAnimInstance>();
+	UFunctionalTestAnimInstance* LinkedInstance = NewObject<UFunctionalTestAnimInstance>();
+	AnimInstance->BoneSettings.Damping = 0.5f;
+	AnimInstance->LinkedInstance = LinkedInstance;
+	LinkedInstance->BoneSettings.Damping = 0.25f;
+	const FName DampingName(TEXT("BoneSettings.Damping"));
+	const FName LinkedDampingName(TEXT("LinkedInstance.BoneSettings.Damping"));
+	const FAccessVariableParams Params;
+
+	// Only the plain data reached through the structure members is read outside the game thread.
+	TestTrue(TEXT("The structure member should be read on a worker thread"),
+		FVariableAccessAsync::IsThreadSafeRead(AnimInstance, DampingName, Params));
+	TestFalse(TEXT("The path through another object should be read on the game thread"),
+		FVariableAccessAsync::IsThreadSafeRead(AnimInstance, LinkedDampingName, Params));
+	TestFalse(TEXT("The array should be read on the game thread"),
+		FVariableAccessAsync::IsThreadSafeRead(AnimInstance, TEXT("BoneSettingsList"), Params));
+	TestFalse(TEXT("The object reference should be read on the game thread"),
+		FVariableAccessAsync::IsThreadSafeRead(AnimInstance, TEXT("LinkedInstance"), Params));
+
+	TOptional<float> Damping = FVariableAccessAsync::GetNestedVariableByName<float>(AnimInstance, DampingName).GetResult();
+	TestTrue(TEXT("The value should be read on a worker thread"), Damping.IsSet() && Damping.GetValue() == 0.5f);
+	TestFalse(TEXT("The value of another type should not be read"),
+		FVariableAccessAsync::GetNestedVariableByName<int32>(AnimInstance, DampingName).GetResult().IsSet());
+
+	// The accesses on the game thread run immediately, so that waiting for them there does not deadlock.
+	UE::Tasks::TTask<TOptional<float>> SetTask =
+		FVariableAccessAsync::SetNestedVariableByName<float>(AnimInstance, DampingName, 0.75f);
+	TestEqual(TEXT("The value should be set before the task is waited for"), AnimInstance->BoneSettings.Damping, 0.75f);
+	TestTrue(TEXT("The set value should be the result"), SetTask.GetResult().Get(0.0f) == 0.75f);
+	Damping = FVariableAccessAsync::GetNestedVariableByName<float>(AnimInstance, LinkedDampingName).GetResult();
+	TestTrue(TEXT("The value through another object should be read"), Damping.IsSet() && Damping.GetValue() == 0.25f);
+
+	// The accesses from a worker thread are marshalled to the game thread, which processes its tasks until they finish.
+	UE::Tasks::TTask<TOptional<float>> WorkerTask = UE::Tasks::Launch(TEXT("FunctionalTestAsyncAccess"),
+		[AnimInstance, LinkedDampingName]()
+		{
+			FVariableAccessAsync::SetNestedVariableByName<float>(AnimInstance, LinkedDampingName, 1.5f).Wait();
+			return FVariableAccessAsync::GetNestedVariableByName<float>(AnimInstance, LinkedDampingName).GetResult();
+		});
+	while (!WorkerTask.IsCompleted())
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FPlatformProcess::Sleep(0.0f);
+	}
+	TestEqual(TEXT("The value should be set from a worker thread"), LinkedInstance->BoneSettings.Damping, 1.5f);
+	TestTrue(TEXT("The value should be read from a worker thread"), WorkerTask.GetResult().Get(0.0f) == 1.5f);
+#endif
+
+	return true;
+}
+
+bool FFunctionalTestWriteBuffer::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	AActor* DestroyedActor = World->SpawnActor<AActor>();
+	UFunctionalTestContainers* Containers = NewObject<UFunctionalTestContainers>();
+	FProperty* LifeSpanProperty = FindFProperty<FProperty>(AActor::StaticClass(), TEXT("InitialLifeSpan"));
+	FProperty* SumProperty = FindFProperty<FProperty>(UFunctionalTestContainers::StaticClass(), TEXT("Sum"));
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	TestNotNull(TEXT("Destroyed actor should not be null"), DestroyedActor);
+	if (Actor == nullptr || DestroyedActor == nullptr || LifeSpanProperty == nullptr || SumProperty == nullptr)
+	{
+		return false;
+	}
+	Actor->InitialLifeSpan = 0.0f;
+
+	TSharedPtr<FVarAccessWritePath, ESPMode::ThreadSafe> LifeSpanPath =
+		FVarAccessWritePath::Create(TEXT("InitialLifeSpan"), LifeSpanProperty);
+	TSharedPtr<FVarAccessWritePath, ESPMode::ThreadSafe> SumPath = FVarAccessWritePath::Create(TEXT("Sum"), SumProperty,
+		FAccessVariableParams(), [](const FProperty* Property, void* AccumulatedAddr, const void* IncomingAddr)
+		{ *static_cast<int32*>(AccumulatedAddr) += *static_cast<const int32*>(IncomingAddr); });
+	TestTrue(TEXT("The paths should be created"), LifeSpanPath.IsValid() && SumPath.IsValid());
+	TestFalse(TEXT("The path without the type should be refused"), FVarAccessWritePath::Create(TEXT("Sum"), nullptr).IsValid());
+	if (!LifeSpanPath.IsValid() || !SumPath.IsValid())
+	{
+		return false;
+	}
+
+	FVarAccessWriteBuffer Buffer;
+	TArray<uint64> LifeSpanIds;
+	uint64 DestroyedId = 0;
+	uint64 NotFoundId = 0;
+	{
+		FVarAccessWriteBuffer::FWriter Writer(Buffer);
+		for (float LifeSpan : {1.0f, 2.0f, 3.0f})
+		{
+			LifeSpanIds.Add(Writer.Enqueue(Actor, *LifeSpanPath, LifeSpan));
+		}
+		DestroyedId = Writer.Enqueue(DestroyedActor, *LifeSpanPath, 4.0f);
+		NotFoundId = Writer.Enqueue(Actor, *SumPath, 5);
+		TestEqual(TEXT("The value of another type should be refused"), Writer.Enqueue(Actor, *LifeSpanPath, 6), (uint64)0);
+	}
+	DestroyedActor->Destroy();
+
+	// The last write to the same variable wins, and each write reports its status.
+	TArray<FVarAccessWriteResult> Results;
+	TestEqual(TEXT("One variable should be written"), Buffer.Flush(&Results), 1);
+	TestEqual(TEXT("The last write should win"), Actor->InitialLifeSpan, 3.0f);
+	TMap<uint64, EVarAccessWriteStatus> Statuses;
+	for (const FVarAccessWriteResult& Result : Results)
+	{
+		Statuses.Add(Result.WriteId, Result.Status);
+	}
+	TestEqual(TEXT("Each write should have a result"), Statuses.Num(), 5);
+	TestTrue(TEXT("The earlier writes should be superseded"),
+		Statuses.FindRef(LifeSpanIds[0]) == EVarAccessWriteStatus::Superseded &&
+			Statuses.FindRef(LifeSpanIds[1]) == EVarAccessWriteStatus::Superseded);
+	TestTrue(TEXT("The last write should be written"), Statuses.FindRef(LifeSpanIds[2]) == EVarAccessWriteStatus::Written);
+	TestTrue(TEXT("The write to the destroyed target should report it"),
+		Statuses.FindRef(DestroyedId) == EVarAccessWriteStatus::InvalidTarget);
+	TestTrue(TEXT("The write to the missing variable should report it"),
+		Statuses.FindRef(NotFoundId) == EVarAccessWriteStatus::NotFound);
+	TestEqual(TEXT("The flushed writes should not be applied again"), Buffer.Flush(), 0);
+
+	// The writes of many threads to the same variable are merged.
+	const int32 NumThreads = 8;
+	const int32 NumWritesPerThread = 1000;
+	TArray<TFuture<void>> Futures;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		Futures.Add(Async(EAsyncExecution::Thread,
+			[&Buffer, &SumPath, Containers, NumWritesPerThread]()
+			{
+				FVarAccessWriteBuffer::FWriter Writer(Buffer);
+				for (int32 Index = 0; Index < NumWritesPerThread; ++Index)
+				{
+					Writer.Enqueue(Containers, *SumPath, 1);
+				}
+			}));
+	}
+	for (TFuture<void>& Future : Futures)
+	{
+		Future.Wait();
+	}
+	TestEqual(TEXT("The merged writes should be one variable"), Buffer.Flush(&Results), 1);
+	TestEqual(TEXT("All writes should be merged"), Containers->Sum, NumThreads * NumWritesPerThread);
+	int32 NumMerged = 0;
+	for (const FVarAccessWriteResult& Result : Results)
+	{
+		NumMerged += Result.Status == EVarAccessWriteStatus::Written ? 1 : 0;
+	}
+	TestEqual(TEXT("All merged writes should be written"), NumMerged, NumThreads * NumWritesPerThread);
+
+	Actor->Destroy();
+
+	return true;
+}
+
+bool FFunctionalTestMissingVariableCache::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEngine->GetWorldContexts()[0].World();
+	AActor* Actor = World->SpawnActor<AActor>();
+	UFunctionalTestContainers* Containers = NewObject<UFunctionalTestContainers>();
+	TestNotNull(TEXT("Actor should not be null"), Actor);
+	if (Actor == nullptr)
+	{
+		return false;
+	}
+
+	// The missing variable is remembered on the link of the class.
+	const FAccessVariableParams Params;
+	FVarAccessChain Chain;
+	FVariableAccessFunctionLibraryUtils::ParseVarName(FString(TEXT("Sum")), &Chain.VarDescs);
+	Chain.Links.SetNum(Chain.VarDescs.Num());
+	TestNull(TEXT("The missing variable should not be resolved"),
+		FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(&Chain, Actor, nullptr, Params).Get<1>());
+	TestTrue(TEXT("The miss should be remembered for the class"),
+		Chain.Links[0].Owner == AActor::StaticClass() && Chain.Links[0].Property == nullptr);
+	TestNull(TEXT("The remembered miss should fail again"),
+		FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(&Chain, Actor, nullptr, Params).Get<1>());
+
+	// The miss of another class does not hide the variable of the class which has it.
+	TestTrue(TEXT("The class which has the variable should resolve it"),
+		FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(&Chain, Containers, nullptr, Params).Get<1>() ==
+			&Containers->Sum);
+
+	Actor->Destroy();
+
+#if WITH_EDITOR
+	// The miss is forgotten when the Blueprint which adds the variable is recompiled.
+	UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(UFunctionalTestContainers::StaticClass(),
+		GetTransientPackage(), TEXT("MissingVariableCacheTest"), BPTYPE_Normal, UBlueprint::StaticClass(),
+		UBlueprintGeneratedClass::StaticClass());
+	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	const FName AddedName(TEXT("AddedCount"));
+	FNameBuilder AddedNameBuilder(AddedName);
+	UObject* Object = NewObject<UObject>(GetTransientPackage(), Blueprint->GeneratedClass);
+	FVarAccessChain* ThreadChain =
+		FVariableAccessFunctionLibraryUtils::FindThreadChain(Object, AddedNameBuilder.ToView(), Params);
+	TestTrue(TEXT("The variable should be missing before it is added"),
+		ThreadChain != nullptr &&
+			FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(ThreadChain, Object, nullptr, Params).Get<1>() ==
+				nullptr);
+
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+	FEdGraphPinType PinType;
+	PinType.PinCategory = UEdGraphSchema_K2::PC_Int;
+	FBlueprintEditorUtils::AddMemberVariable(Blueprint, AddedName, PinType);
+	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	TestTrue(TEXT("The recompilation should invalidate the caches"), FVariableAccessFunctionLibraryUtils::GetCacheEpoch() != Epoch);
+
+	Object = NewObject<UObject>(GetTransientPackage(), Blueprint->GeneratedClass);
+	ThreadChain = FVariableAccessFunctionLibraryUtils::FindThreadChain(Object, AddedNameBuilder.ToView(), Params);
+	TestTrue(TEXT("The added variable should be resolved after the recompilation"),
+		ThreadChain != nullptr &&
+			FVariableAccessFunctionLibraryUtils::ResolveTerminalProperty(ThreadChain, Object, nullptr, Params).Get<1>() !=
+				nullptr);
+#endif
+
+	return true;
+}
+
+bool FFunctionalTestUserDefinedStruct::RunTest(const FString& Parameters)
+{
+#if WITH_EDITOR
+	UUserDefinedStruct* Struct =
+		FStructureEditorUtils::CreateUserDefinedStruct(GetTransientPackage(), TEXT("UserDefinedStructTest"), RF_Transient);
+	TestNotNull(TEXT("The struct should be created"), Struct);
+	if (Struct == nullptr || FStructureEditorUtils::GetVarDesc(Struct).Num() == 0)
+	{
+		return false;
+	}
+	const FGuid VarGuid = FStructureEditorUtils::GetVarDesc(Struct)[0].VarGuid;
+
+	// The member is found by the name shown in the editor, not by its internal name.
+	FStructureEditorUtils::RenameVariable(Struct, VarGuid, TEXT("Speed"));
+	FProperty* Property = FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(Struct, TEXT("Speed"));
+	TestTrue(TEXT("The member should be found by its authored name"),
+		Property != nullptr && Property->GetAuthoredName() == TEXT("Speed"));
+	TestTrue(TEXT("The repeated lookup should find the same member"),
+		FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(Struct, TEXT("Speed")) == Property);
+	if (Property != nullptr)
+	{
+		TestNull(TEXT("The member should not be found by its internal name"),
+			FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(Struct, Property->GetName()));
+	}
+
+	// The change of the struct invalidates the index of the members.
+	const uint32 Epoch = FVariableAccessFunctionLibraryUtils::GetCacheEpoch();
+	FStructureEditorUtils::RenameVariable(Struct, VarGuid, TEXT("Velocity"));
+	TestTrue(TEXT("The change of the struct should invalidate the caches"),
+		FVariableAccessFunctionLibraryUtils::GetCacheEpoch() != Epoch);
+	TestNull(TEXT("The old name should not be found after the change"),
+		FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(Struct, TEXT("Speed")));
+	Property = FVariableAccessFunctionLibraryUtils::GetScriptStructProperty(Struct, TEXT("Velocity"));
+	TestTrue(TEXT("The new name should be found after the change"),
+		Property != nullptr && Property->GetAuthoredName() == TEXT("Velocity"));
+#endif
+
+	return true;
+}
+
+bool FFunctionalTestClassPropertyTable::RunTest(const FString& Parameters)
+{
+	// The table finds the same properties as the walk over the class hierarchy.
+	const UClass* Classes[] = {AActor::StaticClass(), APawn::StaticClass(), UFunctionalTestAnimInstance::StaticClass()};
+	for (const UClass* Class : Classes)
+	{
+		int32 NumMismatches = 0;
+		for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			if (FVariableAccessFunctionLibraryUtils::FindClassProperty(Class, It->GetFName()) !=
+				FindFProperty<FProperty>(Class, It->GetFName()))
+			{
+				NumMismatches++;
+			}
+		}
+		TestEqual(FString::Printf(TEXT("The table of '%s' should match the class hierarchy"), *Class->GetName()),
+			NumMismatches, 0);
+	}
+	TestTrue(TEXT("The inherited member should be found on the subclass"),
+		FVariableAccessFunctionLibraryUtils::FindClassProperty(APawn::StaticClass(), TEXT("InitialLifeSpan")) ==
+			FindFProperty<FProperty>(AActor::StaticClass(), TEXT("InitialLifeSpan")));
+	TestNull(TEXT("The missing member should not be found"),
+		FVariableAccessFunctionLibraryUtils::FindClassProperty(APawn::StaticClass(), TEXT("NoSuchVariable")));
+	TestNull(TEXT("No property should be found without a class"),
+		FVariableAccessFunctionLibraryUtils::FindClassProperty(nullptr, TEXT("Tags")));
+
+	// The member of the subclass hides the inherited member of the same name, also when it is added after the first lookup.
+	FProperty* InheritedSum = FindFProperty<FProperty>(UFunctionalTestContainers::StaticClass(), TEXT("Sum"));
+	UClass* Subclass = NewObject<UClass>(GetTransientPackage(), TEXT("ClassPropertyTableTest"), RF_Transient);
+	Subclass->SetSuperStruct(UFunctionalTestContainers::StaticClass());
+	TestTrue(TEXT("The inherited member should be found before it is hidden"),
+		FVariableAccessFunctionLibraryUtils::FindClassProperty(Subclass, TEXT("Sum")) == InheritedSum);
+	FIntProperty* ShadowingSum = new FIntProperty(Subclass, TEXT("Sum"), RF_Public);
+	Subclass->AddCppProperty(ShadowingSum);
+	TestTrue(TEXT("The member of the subclass should hide the inherited member"),
+		FVariableAccessFunctionLibraryUtils::FindClassProperty(Subclass, TEXT("Sum")) == ShadowingSum);
+	TestTrue(TEXT("The other inherited members should still be found"),
+		FVariableAccessFunctionLibraryUtils::FindClassProperty(Subclass, TEXT("Values")) ==
+			FindFProperty<FProperty>(UFunctionalTestContainers::StaticClass(), TEXT("Values")));
+	TestTrue(TEXT("The superclass should still find its own member"),
+		FVariableAccessFunctionLibraryUtils::FindClassProperty(UFunctionalTestContainers::StaticClass(), TEXT("Sum")) ==
+			InheritedSum);
+
+	// Drop the table of the transient class, so that a class allocated at the same address later does not reuse it.
+	FVariableAccessFunctionLibraryUtils::InvalidateCaches();
+
+	return true;
+}
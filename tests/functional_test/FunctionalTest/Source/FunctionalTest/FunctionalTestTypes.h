@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Animation/AnimInstance.h"
+#include "CoreMinimal.h"
+
+#include "FunctionalTestTypes.generated.h"
+
+USTRUCT()
+struct FFunctionalTestBoneSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float Stiffness = 0.0f;
+
+	UPROPERTY()
+	float Damping = 0.0f;
+};
+
+// Anim instance whose variables are read on the worker threads.
+UCLASS()
+class FUNCTIONALTEST_API UFunctionalTestAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FFunctionalTestBoneSettings BoneSettings;
+
+	UPROPERTY()
+	TArray<FFunctionalTestBoneSettings> BoneSettingsList;
+
+	UPROPERTY()
+	UFunctionalTestAnimInstance* LinkedInstance = nullptr;
+};
+
+// Object which holds the containers changed by name.
+UCLASS()
+class FUNCTIONALTEST_API UFunctionalTestContainers : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "FunctionalTest")
+	void AddToSum(int32 Value)
+	{
+		Sum += Value;
+	}
+
+	UPROPERTY()
+	TMap<FName, int32> NameCounts;
+
+	UPROPERTY()
+	TArray<int32> Values;
+
+	UPROPERTY()
+	int32 Sum = 0;
+};
@@ -0,0 +1,163 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "PathCore/VarAccessPath.h"
+#include "PathCore/VarAccessPathCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using FSegment = VarAccessPath::TSegment<char16_t>;
+using FCache = VarAccessPath::TParseCache<char16_t, std::vector<FSegment>>;
+using FClock = std::chrono::steady_clock;
+
+// Paths like the ones used by the plugin. TCHAR of the engine on Linux is char16_t.
+std::vector<std::u16string> MakePaths(int NumPaths)
+{
+	std::vector<std::u16string> Paths;
+	for (int Index = 0; Index < NumPaths; ++Index)
+	{
+		std::u16string Number;
+		for (char Ch : std::to_string(Index))
+		{
+			Number.push_back(static_cast<char16_t>(Ch));
+		}
+		switch (Index % 4)
+		{
+			case 0:
+				Paths.push_back(u"Health" + Number);
+				break;
+			case 1:
+				Paths.push_back(u"Inventory.Items[" + Number + u"].Count");
+				break;
+			case 2:
+				Paths.push_back(u"Stats.Tags[\"Key" + Number + u"\"].Value");
+				break;
+			default:
+				Paths.push_back(u"Party.Members[{0}].Equipment.Slots[{1}].Durability" + Number);
+				break;
+		}
+	}
+	return Paths;
+}
+
+void BuildSegments(const char16_t* Path, size_t Length, std::vector<FSegment>& OutSegments)
+{
+	VarAccessPath::Parse(Path, Length, &OutSegments);
+}
+
+double ToNanoseconds(FClock::duration Duration)
+{
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Duration).count());
+}
+
+void RunParse(const std::vector<std::u16string>& Paths, int Iterations)
+{
+	size_t NumSegments = 0;
+	const FClock::time_point Start = FClock::now();
+	for (int Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		for (const std::u16string& Path : Paths)
+		{
+			std::vector<FSegment> Segments;
+			VarAccessPath::Parse(Path.data(), Path.size(), &Segments);
+			NumSegments += Segments.size();
+		}
+	}
+	const double Elapsed = ToNanoseconds(FClock::now() - Start);
+
+	std::printf("Parse (uncached): %.1f ns/path (%zu segments)\n", Elapsed / (double(Iterations) * Paths.size()), NumSegments);
+}
+
+void RunCache(const std::vector<std::u16string>& Paths, int Iterations, int NumThreads)
+{
+	FCache Cache;
+	std::vector<std::thread> Threads;
+	std::vector<size_t> NumSegments(NumThreads, 0);
+
+	const FClock::time_point Start = FClock::now();
+	for (int ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		Threads.emplace_back(
+			[&, ThreadIndex]()
+			{
+				for (int Iteration = 0; Iteration < Iterations; ++Iteration)
+				{
+					for (size_t Index = 0; Index < Paths.size(); ++Index)
+					{
+						const std::u16string& Path = Paths[(Index + ThreadIndex) % Paths.size()];
+						NumSegments[ThreadIndex] += Cache.FindOrAdd(Path.data(), Path.size(), BuildSegments)->Value.size();
+					}
+				}
+			});
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+	const double Elapsed = ToNanoseconds(FClock::now() - Start);
+
+	const VarAccessPath::FCacheStats Stats = Cache.GetStats();
+	const double NumLookups = double(Iterations) * Paths.size() * NumThreads;
+	std::printf("%7d %14.1f %14.1f %12llu %12llu %12llu %12llu\n", NumThreads, NumLookups / (Elapsed / 1.0e9) / 1.0e6,
+		Elapsed * NumThreads / NumLookups, static_cast<unsigned long long>(Stats.L1Hits),
+		static_cast<unsigned long long>(Stats.SharedHits), static_cast<unsigned long long>(Stats.Misses),
+		static_cast<unsigned long long>(Stats.ContendedLocks));
+}
+}	 // namespace
+
+// Usage: VarAccessPathBenchmark [--iterations N] [--paths N] [--threads N]
+int main(int Argc, char** Argv)
+{
+	int Iterations = 20000;
+	int NumPaths = 48;
+	int MaxThreads = 32;
+	for (int Index = 1; Index + 1 < Argc; Index += 2)
+	{
+		if (std::strcmp(Argv[Index], "--iterations") == 0)
+		{
+			Iterations = std::atoi(Argv[Index + 1]);
+		}
+		else if (std::strcmp(Argv[Index], "--paths") == 0)
+		{
+			NumPaths = std::atoi(Argv[Index + 1]);
+		}
+		else if (std::strcmp(Argv[Index], "--threads") == 0)
+		{
+			MaxThreads = std::atoi(Argv[Index + 1]);
+		}
+	}
+	if (Iterations <= 0 || NumPaths <= 0 || MaxThreads <= 0)
+	{
+		std::printf("Usage: VarAccessPathBenchmark [--iterations N] [--paths N] [--threads N]\n");
+		return 1;
+	}
+
+	const std::vector<std::u16string> Paths = MakePaths(NumPaths);
+	std::printf("%d paths, %d iterations\n", NumPaths, Iterations);
+
+	RunParse(Paths, Iterations / 10 > 0 ? Iterations / 10 : 1);
+
+	// The 64 slots of the per-thread cache hold the paths, so most lookups hit it when NumPaths is small.
+	std::printf("%7s %14s %14s %12s %12s %12s %12s\n", "Threads", "Mlookups/s", "ns/lookup", "L1Hits", "SharedHits",
+		"Misses", "Contended");
+	for (int NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+	{
+		RunCache(Paths, Iterations, NumThreads);
+	}
+
+	return 0;
+}
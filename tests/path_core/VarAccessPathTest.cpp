@@ -0,0 +1,324 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "PathCore/VarAccessPath.h"
+#include "PathCore/VarAccessPathCache.h"
+#include "PathCore/VarAccessStaticPath.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+int NumFailures = 0;
+
+void Check(bool bResult, const char* Expr, int Line)
+{
+	if (!bResult)
+	{
+		std::printf("%s:%d: check failed: %s\n", __FILE__, Line, Expr);
+		++NumFailures;
+	}
+}
+
+#define TEST_TRUE(Expr) Check((Expr), #Expr, __LINE__)
+
+using FSegment = VarAccessPath::TSegment<char>;
+using VarAccessPath::EIndexType;
+
+std::vector<FSegment> Parse(const char* Path)
+{
+	std::vector<FSegment> Segments;
+	VarAccessPath::Parse(Path, std::strlen(Path), &Segments);
+	return Segments;
+}
+
+FSegment ParseSegment(const char* Segment)
+{
+	return VarAccessPath::ParseSegment(Segment, std::strlen(Segment));
+}
+
+std::vector<std::string> Tokenize(const char* Path)
+{
+	std::vector<VarAccessPath::FToken> Tokens;
+	VarAccessPath::Tokenize(Path, std::strlen(Path), &Tokens);
+
+	std::vector<std::string> Result;
+	for (const VarAccessPath::FToken& Token : Tokens)
+	{
+		Result.emplace_back(Path + Token.Offset, Token.Length);
+	}
+	return Result;
+}
+
+void TestTokenize()
+{
+	TEST_TRUE(Tokenize("A") == std::vector<std::string>({"A"}));
+	TEST_TRUE(Tokenize("A.B.C") == std::vector<std::string>({"A", "B", "C"}));
+	TEST_TRUE(Tokenize("A..B.") == std::vector<std::string>({"A", "B"}));
+	TEST_TRUE(Tokenize("").empty());
+	TEST_TRUE(Tokenize("...").empty());
+	// The dots in the string keys do not split the path.
+	TEST_TRUE(Tokenize("Map[\"a.b\"].C") == std::vector<std::string>({"Map[\"a.b\"]", "C"}));
+}
+
+void TestParseSegment()
+{
+	FSegment Name = ParseSegment("Health");
+	TEST_TRUE(Name.bIsValid && Name.Name == "Health" && Name.IndexType == EIndexType::None);
+	TEST_TRUE(Name.Integer == -1 && Name.ArgumentIndex == -1);
+
+	FSegment Spaced = ParseSegment("_My Var 2");
+	TEST_TRUE(Spaced.bIsValid && Spaced.Name == "_My Var 2");
+
+	FSegment Integer = ParseSegment("Items[12]");
+	TEST_TRUE(Integer.bIsValid && Integer.Name == "Items" && Integer.IndexType == EIndexType::Integer);
+	TEST_TRUE(Integer.Integer == 12 && Integer.ArgumentIndex == -1);
+
+	FSegment IntegerArgument = ParseSegment("Items[{3}]");
+	TEST_TRUE(IntegerArgument.bIsValid && IntegerArgument.IndexType == EIndexType::Integer);
+	TEST_TRUE(IntegerArgument.Integer == -1 && IntegerArgument.ArgumentIndex == 3);
+
+	FSegment String = ParseSegment("Tags[\"Rare\"]");
+	TEST_TRUE(String.bIsValid && String.Name == "Tags" && String.IndexType == EIndexType::String);
+	TEST_TRUE(String.String == "Rare" && String.ArgumentIndex == -1);
+
+	FSegment StringArgument = ParseSegment("Tags[\"{1}\"]");
+	TEST_TRUE(StringArgument.bIsValid && StringArgument.IndexType == EIndexType::String);
+	TEST_TRUE(StringArgument.String == "{1}" && StringArgument.ArgumentIndex == 1);
+
+	// The key is any non-space characters, including the quotes.
+	FSegment Quoted = ParseSegment("Tags[\"a\"b\"]");
+	TEST_TRUE(Quoted.bIsValid && Quoted.String == "a\"b");
+
+	FSegment Clamped = ParseSegment("Items[99999999999]");
+	TEST_TRUE(Clamped.bIsValid && Clamped.Integer == 2147483647);
+
+	const char* Invalids[] = {"", "1Items", "Items[", "Items[]", "Items[a]", "Items[-1]", "Items[{}]", "Items[{a}]",
+		"Tags[\"\"]", "Tags[\"a b\"]", "Tags[\"a\tb\"]", "Items[0]x", "Items [0] ", "It-ems", "Items[0][1]"};
+	for (const char* Invalid : Invalids)
+	{
+		FSegment Segment = ParseSegment(Invalid);
+		if (Segment.bIsValid)
+		{
+			std::printf("unexpectedly valid: %s\n", Invalid);
+			++NumFailures;
+		}
+	}
+}
+
+void TestParse()
+{
+	std::vector<FSegment> Segments = Parse("Inventory.Items[0].Tags[\"a.b\"].Count");
+	TEST_TRUE(Segments.size() == 4);
+	TEST_TRUE(Segments[0].Name == "Inventory" && Segments[0].IndexType == EIndexType::None);
+	TEST_TRUE(Segments[1].Name == "Items" && Segments[1].Integer == 0);
+	TEST_TRUE(Segments[2].Name == "Tags" && Segments[2].String == "a.b");
+	TEST_TRUE(Segments[3].Name == "Count" && Segments[3].bIsValid);
+
+	std::vector<FSegment> WithInvalid = Parse("A.1B.C");
+	TEST_TRUE(WithInvalid.size() == 3 && WithInvalid[0].bIsValid && !WithInvalid[1].bIsValid && WithInvalid[2].bIsValid);
+
+	// TCHAR is char16_t or wchar_t.
+	const char16_t* Wide = u"Slots[{0}].Name";
+	std::vector<VarAccessPath::TSegment<char16_t>> WideSegments;
+	VarAccessPath::Parse(Wide, std::char_traits<char16_t>::length(Wide), &WideSegments);
+	TEST_TRUE(WideSegments.size() == 2 && WideSegments[0].ArgumentIndex == 0 && WideSegments[1].Name == u"Name");
+
+	const wchar_t* Key = L"Map[\"\u00e9l\u00e8ve\"]";
+	VarAccessPath::TSegment<wchar_t> KeySegment = VarAccessPath::ParseSegment(Key, std::char_traits<wchar_t>::length(Key));
+	TEST_TRUE(KeySegment.bIsValid && KeySegment.String == L"\u00e9l\u00e8ve");
+
+	const wchar_t* SpacedKey = L"Map[\"a\u3000b\"]";
+	TEST_TRUE(!VarAccessPath::ParseSegment(SpacedKey, std::char_traits<wchar_t>::length(SpacedKey)).bIsValid);
+}
+
+void TestArgumentIndex()
+{
+	TEST_TRUE(VarAccessPath::ParseArgumentIndex("{0}", 3) == 0);
+	TEST_TRUE(VarAccessPath::ParseArgumentIndex("{42}", 4) == 42);
+	TEST_TRUE(VarAccessPath::ParseArgumentIndex("{}", 2) == -1);
+	TEST_TRUE(VarAccessPath::ParseArgumentIndex("{a}", 3) == -1);
+	TEST_TRUE(VarAccessPath::ParseArgumentIndex("0", 1) == -1);
+}
+
+void TestHash()
+{
+	TEST_TRUE(VarAccessPath::HashPath("A.B", 3) == VarAccessPath::HashPath("A.B", 3));
+	TEST_TRUE(VarAccessPath::HashPath("A.B", 3) != VarAccessPath::HashPath("A.C", 3));
+	TEST_TRUE(VarAccessPath::HashPath("A.B", 3) == VarAccessPath::HashPath(u"A.B", 3));
+}
+
+// Parsed by the compiler.
+constexpr auto StaticPath = VAR_ACCESS_STATIC_PATH("Inventory.Items[{0}].Tags[\"a.b\"].Slots[3]");
+static_assert(StaticPath.bIsValid, "The static path should be valid");
+static_assert(StaticPath.NumSegments == 4, "The static path should have 4 segments");
+static_assert(StaticPath.Segments[0].NameLength == 9 && StaticPath.Segments[0].IndexType == EIndexType::None, "Inventory");
+static_assert(StaticPath.Segments[1].IndexType == EIndexType::Integer && StaticPath.Segments[1].ArgumentIndex == 0, "Items[{0}]");
+static_assert(StaticPath.Segments[2].IndexType == EIndexType::String && StaticPath.Segments[2].StringLength == 3, "Tags");
+static_assert(StaticPath.Segments[3].Integer == 3 && StaticPath.Segments[3].ArgumentIndex == -1, "Slots[3]");
+
+constexpr auto WideStaticPath = VAR_ACCESS_STATIC_PATH(u"Stats.Health");
+static_assert(WideStaticPath.NumSegments == 2 && WideStaticPath.Hash == VarAccessPath::HashPath(u"Stats.Health", 12),
+	"The hash should be same as the one at runtime");
+
+// The static parser and the runtime parser give the same segments.
+template <size_t MaxSegments>
+void CheckStaticPath(const VarAccessPath::TStaticPath<char, MaxSegments>& Path, const char* Literal)
+{
+	const std::vector<FSegment> Segments = Parse(Literal);
+	TEST_TRUE(Path.NumSegments == Segments.size());
+	for (size_t Index = 0; Index < Path.NumSegments && Index < Segments.size(); ++Index)
+	{
+		const VarAccessPath::TSegmentView<char>& View = Path.Segments[Index];
+		const FSegment& Segment = Segments[Index];
+		TEST_TRUE(View.bIsValid == Segment.bIsValid);
+		TEST_TRUE(std::string(View.Name, View.NameLength) == Segment.Name);
+		TEST_TRUE(View.IndexType == Segment.IndexType);
+		TEST_TRUE(View.Integer == Segment.Integer && View.ArgumentIndex == Segment.ArgumentIndex);
+		TEST_TRUE(std::string(View.String != nullptr ? View.String : "", View.StringLength) == Segment.String);
+	}
+	TEST_TRUE(Path.Hash == VarAccessPath::HashPath(Literal, std::strlen(Literal)));
+}
+
+void TestStaticPath()
+{
+	CheckStaticPath(StaticPath, "Inventory.Items[{0}].Tags[\"a.b\"].Slots[3]");
+
+	constexpr auto Spaced = VAR_ACCESS_STATIC_PATH("..My Var.Tags[\"{2}\"]..");
+	CheckStaticPath(Spaced, "..My Var.Tags[\"{2}\"]..");
+	TEST_TRUE(Spaced.Segments[1].ArgumentIndex == 2);
+
+	// Not parsed by the compiler, so the malformed path is only marked as invalid.
+	const char Malformed[] = "A.1B";
+	TEST_TRUE(!VarAccessPath::ParseStaticPath<2>(Malformed).bIsValid);
+}
+
+using FCache = VarAccessPath::TParseCache<char, std::vector<FSegment>>;
+
+void BuildSegments(const char* Path, size_t Length, std::vector<FSegment>& OutSegments)
+{
+	VarAccessPath::Parse(Path, Length, &OutSegments);
+}
+
+void TestCache()
+{
+	FCache Cache;
+
+	const FCache::FEntryPtr& First = Cache.FindOrAdd("A.B[1]", 6, BuildSegments);
+	TEST_TRUE(First && First->Value.size() == 2 && First->Value[1].Integer == 1);
+	VarAccessPath::FCacheStats Stats = Cache.GetStats();
+	TEST_TRUE(Stats.Misses == 1 && Stats.SharedHits == 0);
+
+	const FCache::FEntry* FirstEntry = First.get();
+	TEST_TRUE(Cache.FindOrAdd("A.B[1]", 6, BuildSegments).get() == FirstEntry);
+	// The prefix of a cached path is another path.
+	TEST_TRUE(Cache.FindOrAdd("A.B", 3, BuildSegments)->Value.size() == 2);
+	TEST_TRUE(Cache.GetStats().Misses == 2);
+
+	// Another thread finds the entry in the shared cache.
+	std::thread([&Cache, FirstEntry]() { TEST_TRUE(Cache.FindOrAdd("A.B[1]", 6, BuildSegments).get() == FirstEntry); })
+		.join();
+	Stats = Cache.GetStats();
+	TEST_TRUE(Stats.SharedHits == 1 && Stats.Misses == 2);
+	// The hit on the per-thread cache of this thread is still pending.
+	TEST_TRUE(Stats.L1Hits == 0);
+
+	Cache.ResetStats();
+	TEST_TRUE(Cache.GetStats().Misses == 0);
+
+	// The number of the entries is bounded.
+	FCache Small(FCache::NumShards);
+	int NumBuilds = 0;
+	for (int Round = 0; Round < 2; ++Round)
+	{
+		for (int Index = 0; Index < 1000; ++Index)
+		{
+			const std::string Path = "Var" + std::to_string(Index);
+			Small.FindOrAdd(Path.data(), Path.size(), [&NumBuilds](const char* P, size_t L, std::vector<FSegment>& Out)
+				{
+					++NumBuilds;
+					BuildSegments(P, L, Out);
+				});
+		}
+	}
+	TEST_TRUE(NumBuilds > 1000);
+}
+
+void TestCacheConcurrency()
+{
+	FCache Cache;
+	std::vector<std::string> Paths;
+	for (int Index = 0; Index < 200; ++Index)
+	{
+		Paths.push_back("Items[" + std::to_string(Index) + "].Tags[\"K" + std::to_string(Index) + "\"]");
+	}
+
+	const int NumThreads = 8;
+	const int NumRounds = 100;
+	std::vector<int> Errors(NumThreads, 0);
+	std::vector<std::thread> Threads;
+	for (int ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		Threads.emplace_back(
+			[&, ThreadIndex]()
+			{
+				for (int Round = 0; Round < NumRounds; ++Round)
+				{
+					for (size_t Index = 0; Index < Paths.size(); ++Index)
+					{
+						const std::string& Path = Paths[(Index + ThreadIndex * 7) % Paths.size()];
+						const FCache::FEntryPtr& Entry = Cache.FindOrAdd(Path.data(), Path.size(), BuildSegments);
+						if (Entry->Path != Path || Entry->Value.size() != 2 || !Entry->Value[1].bIsValid)
+						{
+							++Errors[ThreadIndex];
+						}
+					}
+				}
+			});
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	for (int Error : Errors)
+	{
+		TEST_TRUE(Error == 0);
+	}
+	// The hits of the exited threads are flushed.
+	const VarAccessPath::FCacheStats Stats = Cache.GetStats();
+	TEST_TRUE(Stats.L1Hits + Stats.SharedHits + Stats.Misses == uint64_t(NumThreads) * NumRounds * Paths.size());
+	TEST_TRUE(Stats.Misses >= Paths.size());
+}
+}	 // namespace
+
+int main()
+{
+	TestTokenize();
+	TestParseSegment();
+	TestParse();
+	TestArgumentIndex();
+	TestHash();
+	TestStaticPath();
+	TestCache();
+	TestCacheConcurrency();
+
+	if (NumFailures > 0)
+	{
+		std::printf("%d checks failed.\n", NumFailures);
+		return 1;
+	}
+
+	std::printf("All checks passed.\n");
+	return 0;
+}
@@ -0,0 +1,18 @@
+/*!
+ * AccessVariableByName
+ *
+ * Copyright (c) 2022 Colory Games
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "PathCore/VarAccessStaticPath.h"
+
+// Must not compile, since the second segment starts with a digit.
+constexpr auto MalformedPath = VAR_ACCESS_STATIC_PATH("Stats.1Health");
+
+int main()
+{
+	return static_cast<int>(MalformedPath.NumSegments);
+}